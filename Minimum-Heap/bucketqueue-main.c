@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ * bucketqueue-main.c -- Test della coda a bucket
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "bucketqueue.h"
+
+int main( int argc, char *argv[] )
+{
+    char op;
+    int n, nbuckets, key;
+    int64_t prio;
+    BucketQueue *h;
+    FILE *filein = stdin;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s inputfile\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "-") != 0) {
+        filein = fopen(argv[1], "r");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (2 != fscanf(filein, "%d %d", &n, &nbuckets)) {
+        fprintf(stderr, "Missing size or number of buckets\n");
+        return EXIT_FAILURE;
+    }
+    printf("bucketqueue_create(%d, %d)\n", n, nbuckets);
+    h = bucketqueue_create(n, nbuckets);
+
+    while (1 == fscanf(filein, " %c", &op)) {
+        switch (op) {
+        case '+': /* insert */
+            fscanf(filein, "%d %" SCNd64, &key, &prio);
+            printf("bucketqueue_insert(h, %d, %" PRId64 ")\n", key, prio);
+            bucketqueue_insert(h, key, prio);
+            break;
+        case '-': /* delete min */
+            key = bucketqueue_delete_min(h);
+            printf("bucketqueue_delete_min(h) = %d\n", key);
+            break;
+        case '?': /* get min */
+            key = bucketqueue_min(h);
+            printf("bucketqueue_min(h) = %d\n", key);
+            break;
+        case 'c': /* change prio */
+            fscanf(filein, "%d %" SCNd64, &key, &prio);
+            printf("bucketqueue_change_prio(h, %d, %" PRId64 ")\n", key, prio);
+            bucketqueue_change_prio(h, key, prio);
+            break;
+        case 'r': /* remove */
+            fscanf(filein, "%d", &key);
+            printf("bucketqueue_remove(h, %d)\n", key);
+            bucketqueue_remove(h, key);
+            break;
+        case 'k': /* contains */
+            fscanf(filein, "%d", &key);
+            printf("bucketqueue_contains(h, %d) = %d\n", key, bucketqueue_contains(h, key));
+            break;
+        case 's': /* get n of elements */
+            printf("bucketqueue_get_n(h) = %d\n", bucketqueue_get_n(h));
+            break;
+        case 'p': /* print */
+            bucketqueue_print(h);
+            break;
+        default:
+            printf("Unknown command %c\n", op);
+            return EXIT_FAILURE;
+        }
+    }
+
+    bucketqueue_destroy(h);
+    if (filein != stdin) fclose(filein);
+
+    return EXIT_SUCCESS;
+}
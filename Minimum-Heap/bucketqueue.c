@@ -0,0 +1,274 @@
+/****************************************************************************
+ *
+ * bucketqueue.c -- Coda a bucket (algoritmo di Dial)
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Coda a bucket
+% Ultimo aggiornamento: 2026-10-19
+
+Se le priorità sono interi e, in ogni istante, sono tutte comprese in
+una finestra di ampiezza $C$ che inizia dall'ultima priorità estratta
+$\mathit{last}$, una coda di priorità può essere realizzata con un
+array circolare di $C$ _bucket_ (algoritmo di Dial): la coppia di
+priorità $p$ si trova nel bucket $p \bmod C$, e tutte le coppie di un
+bucket hanno la stessa priorità.
+
+Ogni bucket è una lista doppiamente concatenata di chiavi; le liste
+sono memorizzate negli array `next[]` e `prev[]`, indicizzati dalla
+chiave, per cui non è necessario allocare memoria durante le
+operazioni. Quindi:
+
+- `bucketqueue_insert()`, `bucketqueue_change_prio()` e
+  `bucketqueue_remove()` richiedono tempo $O(1)$;
+
+- `bucketqueue_delete_min()` esamina i bucket a partire da quello di
+  $\mathit{last}$ fino al primo non vuoto. Se le priorità estratte
+  crescono di poco ad ogni passo, come accade ad esempio per le code
+  di timeout o nell'algoritmo di Dijkstra con pesi piccoli, il costo
+  medio è $O(1)$; in ogni caso non supera $O(C)$.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic bucketqueue.c bucketqueue-main.c -o bucketqueue-main
+
+Per eseguire:
+
+        ./bucketqueue-main inputfile
+
+dove `inputfile` contiene, dopo la dimensione, il numero di bucket
+$C$ e poi i comandi `+`, `-`, `?`, `c`, `r`, `k`, `s` e `p` di
+[minheap-main.c](minheap-main.c), con priorità intere.
+
+## File
+
+- [bucketqueue.c](bucketqueue.c)
+- [bucketqueue.h](bucketqueue.h)
+- [bucketqueue-main.c](bucketqueue-main.c)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <inttypes.h>
+#include "bucketqueue.h"
+
+/* Funzione di supporto: restituisce il bucket della priorità p */
+static int bucket_of(const BucketQueue *q, int64_t p)
+{
+    return (int)(p % q->nbuckets);
+}
+
+/* Funzione di supporto: inserisce la chiave `key` nel bucket della
+   sua priorità */
+static void link_key(BucketQueue *q, int key)
+{
+    const int b = bucket_of(q, q->prio[key]);
+
+    q->prev[key] = -1;
+    q->next[key] = q->head[b];
+    if (q->head[b] != -1) {
+        q->prev[q->head[b]] = key;
+    }
+    q->head[b] = key;
+}
+
+/* Funzione di supporto: toglie la chiave `key` dal suo bucket */
+static void unlink_key(BucketQueue *q, int key)
+{
+    if (q->prev[key] != -1) {
+        q->next[q->prev[key]] = q->next[key];
+    } else {
+        q->head[bucket_of(q, q->prio[key])] = q->next[key];
+    }
+    if (q->next[key] != -1) {
+        q->prev[q->next[key]] = q->prev[key];
+    }
+}
+
+BucketQueue *bucketqueue_create(int size, int nbuckets)
+{
+    BucketQueue *q = (BucketQueue*)malloc(sizeof(*q));
+    int i;
+
+    assert(q != NULL);
+    assert(size > 0);
+    assert(nbuckets > 0);
+
+    q->size = size;
+    q->nbuckets = nbuckets;
+    q->head = (int*)malloc(nbuckets * sizeof(*(q->head)));
+    q->next = (int*)malloc(size * sizeof(*(q->next)));
+    q->prev = (int*)malloc(size * sizeof(*(q->prev)));
+    q->prio = (int64_t*)malloc(size * sizeof(*(q->prio)));
+    q->present = (char*)malloc(size);
+    assert(q->head != NULL && q->next != NULL && q->prev != NULL);
+    assert(q->prio != NULL && q->present != NULL);
+    for (i=0; i<nbuckets; i++) {
+        q->head[i] = -1;
+    }
+    for (i=0; i<size; i++) {
+        q->present[i] = 0;
+    }
+    q->n = 0;
+    q->last = 0;
+    return q;
+}
+
+void bucketqueue_clear(BucketQueue *q)
+{
+    int b, k;
+
+    assert(q != NULL);
+
+    for (b=0; b<q->nbuckets; b++) {
+        for (k=q->head[b]; k != -1; k=q->next[k]) {
+            q->present[k] = 0;
+        }
+        q->head[b] = -1;
+    }
+    q->n = 0;
+    q->last = 0;
+}
+
+void bucketqueue_destroy(BucketQueue *q)
+{
+    assert(q != NULL);
+
+    free(q->head);
+    free(q->next);
+    free(q->prev);
+    free(q->prio);
+    free(q->present);
+    free(q);
+}
+
+int bucketqueue_is_empty(const BucketQueue *q)
+{
+    assert(q != NULL);
+
+    return (q->n == 0);
+}
+
+int bucketqueue_get_n(const BucketQueue *q)
+{
+    assert(q != NULL);
+
+    return q->n;
+}
+
+int bucketqueue_contains(const BucketQueue *q, int key)
+{
+    assert(q != NULL);
+
+    return (key >= 0) && (key < q->size) && q->present[key];
+}
+
+int64_t bucketqueue_get_prio(const BucketQueue *q, int key)
+{
+    assert(bucketqueue_contains(q, key));
+
+    return q->prio[key];
+}
+
+/* Funzione di supporto: restituisce il primo bucket non vuoto a
+   partire da quello di `last` */
+static int first_bucket(const BucketQueue *q)
+{
+    int b = bucket_of(q, q->last);
+
+    assert( !bucketqueue_is_empty(q) );
+
+    while (q->head[b] == -1) {
+        b = (b + 1 < q->nbuckets ? b + 1 : 0);
+    }
+    return b;
+}
+
+int bucketqueue_min(const BucketQueue *q)
+{
+    return q->head[first_bucket(q)];
+}
+
+int64_t bucketqueue_min_prio(const BucketQueue *q)
+{
+    return q->prio[bucketqueue_min(q)];
+}
+
+void bucketqueue_insert(BucketQueue *q, int key, int64_t prio)
+{
+    assert(q != NULL);
+    assert((key >= 0) && (key < q->size));
+    assert( !bucketqueue_contains(q, key) );
+    assert(prio >= q->last && prio - q->last < q->nbuckets);
+
+    q->prio[key] = prio;
+    q->present[key] = 1;
+    link_key(q, key);
+    q->n++;
+}
+
+int bucketqueue_delete_min(BucketQueue *q)
+{
+    const int key = bucketqueue_min(q);
+
+    q->last = q->prio[key];
+    bucketqueue_remove(q, key);
+    return key;
+}
+
+void bucketqueue_change_prio(BucketQueue *q, int key, int64_t newprio)
+{
+    assert(bucketqueue_contains(q, key));
+    assert(newprio >= q->last && newprio - q->last < q->nbuckets);
+
+    unlink_key(q, key);
+    q->prio[key] = newprio;
+    link_key(q, key);
+}
+
+void bucketqueue_remove(BucketQueue *q, int key)
+{
+    assert(bucketqueue_contains(q, key));
+
+    unlink_key(q, key);
+    q->present[key] = 0;
+    q->n--;
+}
+
+void bucketqueue_print(const BucketQueue *q)
+{
+    int b, k;
+
+    assert(q != NULL);
+
+    printf("\n** Contenuto della coda:\n\n");
+    printf("n=%d size=%d nbuckets=%d last=%" PRId64 "\n", q->n, q->size, q->nbuckets, q->last);
+    for (b=0; b<q->nbuckets; b++) {
+        if (q->head[b] != -1) {
+            printf("bucket[%d]:", b);
+            for (k=q->head[b]; k != -1; k=q->next[k]) {
+                printf(" (%d, %" PRId64 ")", k, q->prio[k]);
+            }
+            printf("\n");
+        }
+    }
+    printf("\n\n** Fine contenuto della coda\n\n");
+}
@@ -0,0 +1,106 @@
+/****************************************************************************
+ *
+ * bucketqueue.h -- Interfaccia coda a bucket (algoritmo di Dial)
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef BUCKETQUEUE_H
+#define BUCKETQUEUE_H
+
+#include <stdint.h>
+
+typedef struct {
+    int *head; /* head[b] è la prima chiave del bucket b, -1 se vuoto */
+    int nbuckets; /* numero di bucket, cioè ampiezza della finestra */
+    int *next, *prev; /* liste doppiamente concatenate delle chiavi */
+    int64_t *prio; /* prio[k] è la priorità della chiave k */
+    char *present; /* present[k] != 0 sse la chiave k è presente */
+    int64_t last; /* ultima priorità estratta (inizialmente 0) */
+    int n; /* numero di coppie (chiave, prio) presenti */
+    int size; /* le chiavi sono gli interi 0 .. size-1 */
+} BucketQueue;
+
+/* Crea una coda vuota; le chiavi possono essere gli interi 0 ..
+   `size` - 1, le priorità interi compresi nella finestra [last, last
+   + nbuckets - 1], dove `last` è l'ultima priorità estratta
+   (inizialmente 0).
+
+   Precondizioni: size > 0, nbuckets > 0 */
+BucketQueue *bucketqueue_create(int size, int nbuckets);
+
+/* Svuota la coda; l'ultima priorità estratta torna a 0 */
+void bucketqueue_clear(BucketQueue *q);
+
+/* Dealloca la memoria occupata dalla coda q e dal suo contenuto */
+void bucketqueue_destroy(BucketQueue *q);
+
+/* Restituisce 1 se e solo se la coda è vuota */
+int bucketqueue_is_empty(const BucketQueue *q);
+
+/* Ritorna il numero di elementi presenti nella coda */
+int bucketqueue_get_n(const BucketQueue *q);
+
+/* Restituisce la chiave associata alla minima priorità; non modifica
+   la coda.
+
+   Precondizione: la coda non deve essere vuota. */
+int bucketqueue_min(const BucketQueue *q);
+
+/* Restituisce la minima priorità; non modifica la coda.
+
+   Precondizione: la coda non deve essere vuota. */
+int64_t bucketqueue_min_prio(const BucketQueue *q);
+
+/* Inserisce una nuova chiave `key` con priorità `prio`; tempo O(1).
+
+   Precondizioni:
+   - `key` deve essere una chiave valida e non presente nella coda;
+   - last <= prio < last + nbuckets */
+void bucketqueue_insert(BucketQueue *q, int key, int64_t prio);
+
+/* Rimuove dalla coda la coppia (chiave, prio) con priorità minima, e
+   restituisce la chiave di tale coppia. Il tempo è proporzionale al
+   numero di bucket vuoti che vengono attraversati.
+
+   Precondizione: la coda non deve essere vuota. */
+int bucketqueue_delete_min(BucketQueue *q);
+
+/* Modifica la priorità associata alla chiave `key`; tempo O(1).
+
+   Precondizioni:
+   - la chiave `key` deve essere presente nella coda;
+   - last <= new_prio < last + nbuckets */
+void bucketqueue_change_prio(BucketQueue *q, int key, int64_t new_prio);
+
+/* Restituisce la priorità associata alla chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nella coda. */
+int64_t bucketqueue_get_prio(const BucketQueue *q, int key);
+
+/* Restituisce 1 se e solo se la chiave `key` è presente nella coda */
+int bucketqueue_contains(const BucketQueue *q, int key);
+
+/* Rimuove dalla coda la coppia (chiave, prio) di chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nella coda. */
+void bucketqueue_remove(BucketQueue *q, int key);
+
+/* Stampa il contenuto della coda */
+void bucketqueue_print(const BucketQueue *q);
+
+#endif
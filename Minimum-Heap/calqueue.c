@@ -0,0 +1,433 @@
+/****************************************************************************
+ *
+ * calqueue.c -- Calendar Queue
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Calendar Queue
+% Ultimo aggiornamento: 2026-10-19
+
+La _calendar queue_ (R. Brown, 1988) è una coda di priorità pensata
+per le simulazioni ad eventi discreti, in cui le priorità sono
+istanti di tempo e gli eventi vengono estratti in ordine di tempo
+crescente. Funziona come un calendario da tavolo: il tempo è diviso in
+"giorni" di ampiezza $w$, e gli eventi di giorni che differiscono di
+un multiplo di un "anno" ($B$ giorni, dove $B$ è il numero di bucket)
+vengono annotati sulla stessa pagina. L'evento con tempo $t$ si trova
+quindi nel bucket $\lfloor t / w \rfloor \bmod B$; ogni bucket è una
+lista ordinata per tempo.
+
+Per estrarre il minimo si esaminano i bucket a partire da quello
+corrente, considerando in ciascuno solo il primo evento, e solo se
+appartiene all'anno corrente (cioè se il suo giorno è quello
+corrispondente al bucket nell'anno che inizia da `cur_day`). Se si esamina un
+intero anno senza trovare eventi, il minimo viene cercato direttamente
+tra i primi elementi di tutti i bucket.
+
+Se $w$ è dell'ordine della distanza media tra eventi consecutivi e
+$B$ è proporzionale al numero $n$ di eventi, ogni bucket contiene in
+media pochi eventi e le operazioni richiedono tempo medio $O(1)$. Per
+questo, quando $n$ supera $2B$ o scende sotto $B/2$, il numero di
+bucket viene raddoppiato o dimezzato; la nuova ampiezza $w$ viene
+stimata come tre volte la distanza media tra i primi (al più 25)
+eventi, ignorando le distanze maggiori del doppio della media.
+
+Eventi con lo stesso tempo vengono estratti nell'ordine in cui sono
+stati inseriti.
+
+Le liste sono memorizzate negli array `next[]` e `prev[]` indicizzati
+dalla chiave, come in [bucketqueue.c](bucketqueue.c); la modifica
+della priorità toglie la chiave dal suo bucket e la reinserisce.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic calqueue.c calqueue-main.c -lm -o calqueue-main
+
+Per eseguire:
+
+        ./calqueue-main inputfile
+
+dove `inputfile` contiene i comandi `+`, `-`, `?`, `c`, `r`, `k`, `s`
+e `p` di [minheap-main.c](minheap-main.c), con priorità non negative.
+
+Il file [calqueue-shrink.in](calqueue-shrink.in) è un test di
+regressione: la coda viene dimezzata mentre è vuota, e gli
+inserimenti e le estrazioni successive devono usare il nuovo array di
+bucket (si compili con `-fsanitize=address` per verificarlo).
+
+## File
+
+- [calqueue.c](calqueue.c)
+- [calqueue.h](calqueue.h)
+- [calqueue-main.c](calqueue-main.c)
+- [calqueue-shrink.in](calqueue-shrink.in)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+#include "calqueue.h"
+
+/* Numero minimo di bucket */
+#define CALQ_MIN_BUCKETS 2
+
+/* Numero di eventi usati per stimare l'ampiezza dei bucket */
+#define CALQ_SAMPLE 25
+
+/* Funzione di supporto: restituisce il numero del "giorno" del tempo
+   t, cioè floor(t / width) */
+static double day_of(const CalQueue *q, double t)
+{
+    return floor(t / q->width);
+}
+
+/* Funzione di supporto: restituisce il bucket del tempo t */
+static int bucket_of(const CalQueue *q, double t)
+{
+    return (int)fmod(day_of(q, t), (double)q->nbuckets);
+}
+
+/* Funzione di supporto: fa iniziare la ricerca del minimo dal giorno
+   che contiene il tempo t */
+static void set_current(CalQueue *q, double t)
+{
+    q->cur = bucket_of(q, t);
+    q->cur_day = day_of(q, t);
+}
+
+/* Funzione di supporto: inserisce la chiave `key` nella lista
+   ordinata del suo bucket, dopo gli eventi con lo stesso tempo. La
+   posizione viene cercata a partire dalla fine della lista: i nuovi
+   eventi sono di solito posteriori a quelli già presenti nello stesso
+   giorno, anche quando molti eventi hanno lo stesso tempo (ad esempio
+   se i tempi sono interi). */
+static void link_key(CalQueue *q, int key)
+{
+    const int b = bucket_of(q, q->prio[key]);
+    const double t = q->prio[key];
+    int p = q->tail[b], c = -1;
+
+    while (p != -1 && q->prio[p] > t) {
+        c = p;
+        p = q->prev[p];
+    }
+    q->prev[key] = p;
+    q->next[key] = c;
+    if (p == -1) {
+        q->head[b] = key;
+    } else {
+        q->next[p] = key;
+    }
+    if (c == -1) {
+        q->tail[b] = key;
+    } else {
+        q->prev[c] = key;
+    }
+}
+
+/* Funzione di supporto: toglie la chiave `key` dal suo bucket */
+static void unlink_key(CalQueue *q, int key)
+{
+    const int b = bucket_of(q, q->prio[key]);
+
+    if (q->prev[key] != -1) {
+        q->next[q->prev[key]] = q->next[key];
+    } else {
+        q->head[b] = q->next[key];
+    }
+    if (q->next[key] != -1) {
+        q->prev[q->next[key]] = q->prev[key];
+    } else {
+        q->tail[b] = q->prev[key];
+    }
+}
+
+/* Funzione di supporto: alloca `nb` bucket vuoti */
+static void alloc_buckets(CalQueue *q, int nb, double width)
+{
+    int b;
+
+    q->nbuckets = nb;
+    q->width = width;
+    q->head = (int*)malloc(nb * sizeof(*(q->head)));
+    q->tail = (int*)malloc(nb * sizeof(*(q->tail)));
+    assert(q->head != NULL && q->tail != NULL);
+    for (b=0; b<nb; b++) {
+        q->head[b] = q->tail[b] = -1;
+    }
+}
+
+CalQueue *calqueue_create(int size)
+{
+    CalQueue *q = (CalQueue*)malloc(sizeof(*q));
+    int i;
+
+    assert(q != NULL);
+    assert(size > 0);
+
+    q->size = size;
+    alloc_buckets(q, CALQ_MIN_BUCKETS, 1.0);
+    q->next = (int*)malloc(size * sizeof(*(q->next)));
+    q->prev = (int*)malloc(size * sizeof(*(q->prev)));
+    q->prio = (double*)malloc(size * sizeof(*(q->prio)));
+    q->present = (char*)malloc(size);
+    assert(q->next != NULL && q->prev != NULL);
+    assert(q->prio != NULL && q->present != NULL);
+    for (i=0; i<size; i++) {
+        q->present[i] = 0;
+    }
+    q->n = 0;
+    q->resizing = 0;
+    set_current(q, 0.0);
+    return q;
+}
+
+void calqueue_clear(CalQueue *q)
+{
+    int b, k;
+
+    assert(q != NULL);
+
+    for (b=0; b<q->nbuckets; b++) {
+        for (k=q->head[b]; k != -1; k=q->next[k]) {
+            q->present[k] = 0;
+        }
+        q->head[b] = q->tail[b] = -1;
+    }
+    q->n = 0;
+    set_current(q, 0.0);
+}
+
+void calqueue_destroy(CalQueue *q)
+{
+    assert(q != NULL);
+
+    free(q->head);
+    free(q->tail);
+    free(q->next);
+    free(q->prev);
+    free(q->prio);
+    free(q->present);
+    free(q);
+}
+
+int calqueue_is_empty(const CalQueue *q)
+{
+    assert(q != NULL);
+
+    return (q->n == 0);
+}
+
+int calqueue_get_n(const CalQueue *q)
+{
+    assert(q != NULL);
+
+    return q->n;
+}
+
+int calqueue_contains(const CalQueue *q, int key)
+{
+    assert(q != NULL);
+
+    return (key >= 0) && (key < q->size) && q->present[key];
+}
+
+double calqueue_get_prio(const CalQueue *q, int key)
+{
+    assert(calqueue_contains(q, key));
+
+    return q->prio[key];
+}
+
+/* Funzione di supporto: restituisce la chiave di priorità minima.
+   Tutte le priorità appartengono al giorno corrente o ai successivi;
+   i giorni vengono confrontati (anziché i tempi) per essere coerenti
+   con bucket_of() anche in presenza di errori di arrotondamento. */
+static int find_min(const CalQueue *q)
+{
+    double d = q->cur_day;
+    int i = q->cur, j, k, best = -1;
+
+    assert( !calqueue_is_empty(q) );
+
+    /* un anno a partire dal giorno corrente */
+    for (j=0; j<q->nbuckets; j++) {
+        k = q->head[i];
+        if (k != -1 && day_of(q, q->prio[k]) <= d) {
+            return k;
+        }
+        i = (i + 1 < q->nbuckets ? i + 1 : 0);
+        d += 1.0;
+    }
+    /* ricerca diretta tra i primi elementi dei bucket */
+    for (i=0; i<q->nbuckets; i++) {
+        k = q->head[i];
+        if (k != -1 && (best == -1 || q->prio[k] < q->prio[best])) {
+            best = k;
+        }
+    }
+    return best;
+}
+
+int calqueue_min(const CalQueue *q)
+{
+    return find_min(q);
+}
+
+double calqueue_min_prio(const CalQueue *q)
+{
+    return q->prio[calqueue_min(q)];
+}
+
+/* Funzione di supporto: ricostruisce il calendario con `nb` bucket,
+   stimando una nuova ampiezza dei giorni */
+static void resize(CalQueue *q, int nb)
+{
+    int sample[CALQ_SAMPLE];
+    const double old_width = q->width;
+    double avg = 0.0, avg2 = 0.0, width = q->width, sep;
+    int *old_head = q->head, *old_tail = q->tail;
+    int old_nb = q->nbuckets;
+    int ns = 0, cnt = 0, i, b, k, next;
+
+    q->resizing = 1;
+    /* Stima dell'ampiezza: si estraggono temporaneamente i primi
+       eventi, e si calcola la distanza media tra eventi consecutivi
+       ignorando quelle maggiori del doppio della media */
+    while (ns < CALQ_SAMPLE && !calqueue_is_empty(q)) {
+        sample[ns++] = calqueue_delete_min(q);
+    }
+    if (ns > 1) {
+        avg = (q->prio[sample[ns-1]] - q->prio[sample[0]]) / (ns - 1);
+        for (i=1; i<ns; i++) {
+            sep = q->prio[sample[i]] - q->prio[sample[i-1]];
+            if (sep <= 2.0 * avg) {
+                avg2 += sep;
+                cnt++;
+            }
+        }
+        if (cnt > 0 && avg2 > 0.0) {
+            width = 3.0 * avg2 / cnt;
+        }
+    }
+
+    /* Redistribuzione */
+    alloc_buckets(q, nb, width);
+    for (b=0; b<old_nb; b++) {
+        for (k=old_head[b]; k != -1; k=next) {
+            next = q->next[k];
+            link_key(q, k);
+        }
+    }
+    free(old_head);
+    free(old_tail);
+    for (i=0; i<ns; i++) {
+        calqueue_insert(q, sample[i], q->prio[sample[i]]);
+    }
+    /* cur si riferisce al vecchio array di bucket, e va ricalcolato
+       anche se la coda è vuota */
+    if (ns > 0) {
+        set_current(q, q->prio[sample[0]]);
+    } else {
+        set_current(q, q->cur_day * old_width);
+    }
+    q->resizing = 0;
+}
+
+void calqueue_insert(CalQueue *q, int key, double prio)
+{
+    assert(q != NULL);
+    assert((key >= 0) && (key < q->size));
+    assert( !calqueue_contains(q, key) );
+    assert(prio >= 0.0);
+
+    q->prio[key] = prio;
+    q->present[key] = 1;
+    link_key(q, key);
+    q->n++;
+    /* un evento anteriore al giorno corrente diventa il punto di
+       partenza della ricerca del minimo */
+    if (day_of(q, prio) < q->cur_day) {
+        set_current(q, prio);
+    }
+    if (!q->resizing && q->n > 2 * q->nbuckets) {
+        resize(q, 2 * q->nbuckets);
+    }
+}
+
+/* Funzione di supporto: dimezza il numero di bucket se la coda
+   contiene meno di nbuckets/2 eventi */
+static void shrink(CalQueue *q)
+{
+    if (!q->resizing && q->n < q->nbuckets / 2 && q->nbuckets > CALQ_MIN_BUCKETS) {
+        resize(q, q->nbuckets / 2);
+    }
+}
+
+int calqueue_delete_min(CalQueue *q)
+{
+    const int key = find_min(q);
+
+    set_current(q, q->prio[key]);
+    unlink_key(q, key);
+    q->present[key] = 0;
+    q->n--;
+    shrink(q);
+    return key;
+}
+
+void calqueue_change_prio(CalQueue *q, int key, double newprio)
+{
+    assert(calqueue_contains(q, key));
+
+    calqueue_remove(q, key);
+    calqueue_insert(q, key, newprio);
+}
+
+void calqueue_remove(CalQueue *q, int key)
+{
+    assert(calqueue_contains(q, key));
+
+    unlink_key(q, key);
+    q->present[key] = 0;
+    q->n--;
+    shrink(q);
+}
+
+void calqueue_print(const CalQueue *q)
+{
+    int b, k;
+
+    assert(q != NULL);
+
+    printf("\n** Contenuto della coda:\n\n");
+    printf("n=%d size=%d nbuckets=%d width=%g\n", q->n, q->size, q->nbuckets, q->width);
+    for (b=0; b<q->nbuckets; b++) {
+        if (q->head[b] != -1) {
+            printf("bucket[%d]:", b);
+            for (k=q->head[b]; k != -1; k=q->next[k]) {
+                printf(" (%d, %6.2f)", k, q->prio[k]);
+            }
+            printf("\n");
+        }
+    }
+    printf("\n\n** Fine contenuto della coda\n\n");
+}
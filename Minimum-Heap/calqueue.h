@@ -0,0 +1,107 @@
+/****************************************************************************
+ *
+ * calqueue.h -- Interfaccia Calendar Queue
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef CALQUEUE_H
+#define CALQUEUE_H
+
+typedef struct {
+    int *head; /* head[b] è la prima chiave del bucket b, -1 se vuoto */
+    int *tail; /* tail[b] è l'ultima chiave del bucket b, -1 se vuoto */
+    int nbuckets; /* numero di bucket (potenza di due) */
+    double width; /* ampiezza dell'intervallo di tempo di un bucket */
+    int *next, *prev; /* liste ordinate delle chiavi di ciascun bucket */
+    double *prio; /* prio[k] è la priorità della chiave k */
+    char *present; /* present[k] != 0 sse la chiave k è presente */
+    int cur; /* bucket da cui inizia la ricerca del minimo */
+    double cur_day; /* "giorno" corrente (floor(t / width)), a cui corrisponde il bucket `cur` */
+    int n; /* numero di coppie (chiave, prio) presenti */
+    int size; /* le chiavi sono gli interi 0 .. size-1 */
+    int resizing; /* != 0 durante il ridimensionamento */
+} CalQueue;
+
+/* Crea una calendar queue vuota; le chiavi possono essere gli interi
+   0 .. `size` - 1, le priorità (tipicamente istanti di tempo) numeri
+   reali non negativi.
+
+   Precondizione: size > 0 */
+CalQueue *calqueue_create(int size);
+
+/* Svuota la coda */
+void calqueue_clear(CalQueue *q);
+
+/* Dealloca la memoria occupata dalla coda q e dal suo contenuto */
+void calqueue_destroy(CalQueue *q);
+
+/* Restituisce 1 se e solo se la coda è vuota */
+int calqueue_is_empty(const CalQueue *q);
+
+/* Ritorna il numero di elementi presenti nella coda */
+int calqueue_get_n(const CalQueue *q);
+
+/* Restituisce la chiave associata alla minima priorità; non modifica
+   la coda.
+
+   Precondizione: la coda non deve essere vuota. */
+int calqueue_min(const CalQueue *q);
+
+/* Restituisce la minima priorità; non modifica la coda.
+
+   Precondizione: la coda non deve essere vuota. */
+double calqueue_min_prio(const CalQueue *q);
+
+/* Inserisce una nuova chiave `key` con priorità `prio`; tempo O(1)
+   in media, se la distribuzione delle priorità varia lentamente.
+
+   Precondizioni:
+   - `key` deve essere una chiave valida e non presente nella coda;
+   - prio >= 0 */
+void calqueue_insert(CalQueue *q, int key, double prio);
+
+/* Rimuove dalla coda la coppia (chiave, prio) con priorità minima, e
+   restituisce la chiave di tale coppia; tempo O(1) in media.
+
+   Precondizione: la coda non deve essere vuota. */
+int calqueue_delete_min(CalQueue *q);
+
+/* Modifica la priorità associata alla chiave `key`.
+
+   Precondizioni:
+   - la chiave `key` deve essere presente nella coda;
+   - new_prio >= 0 */
+void calqueue_change_prio(CalQueue *q, int key, double new_prio);
+
+/* Restituisce la priorità associata alla chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nella coda. */
+double calqueue_get_prio(const CalQueue *q, int key);
+
+/* Restituisce 1 se e solo se la chiave `key` è presente nella coda */
+int calqueue_contains(const CalQueue *q, int key);
+
+/* Rimuove dalla coda la coppia (chiave, prio) di chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nella coda. */
+void calqueue_remove(CalQueue *q, int key);
+
+/* Stampa il contenuto della coda */
+void calqueue_print(const CalQueue *q);
+
+#endif
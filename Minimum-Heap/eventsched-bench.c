@@ -0,0 +1,248 @@
+/****************************************************************************
+ *
+ * eventsched-bench.c -- Misura delle prestazioni dello scheduler ad eventi
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Confronta lo scheduler basato su MinHeap (eventsched.c) con uno
+   scheduler che mantiene gli eventi in una lista ordinata per tempo,
+   misurando il numero di eventi eseguiti al secondo.
+
+   Il carico simula `n` entità, ciascuna con un evento pendente.
+   Quando l'evento di un'entità viene eseguito, l'entità si
+   riprogramma con un incremento di tempo casuale uniforme in [0, 2);
+   inoltre, con probabilità P_RESCHED sposta l'evento di un'altra
+   entità scelta a caso, e con probabilità P_CANCEL lo cancella e ne
+   programma uno nuovo (come un timeout che viene rinnovato). Il
+   numero di eventi pendenti resta quindi pari a n.
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread minheap.c eventsched.c eventsched-bench.c -o eventsched-bench
+
+   Per eseguire:
+
+        ./eventsched-bench [nevents]
+
+   dove `nevents` (default 2000000) è il numero approssimativo di
+   eventi eseguiti per ciascuna misura. Per valori grandi di n la
+   lista ordinata esegue meno eventi, in modo che il tempo della
+   misura resti accettabile. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <assert.h>
+#include "eventsched.h"
+
+#define P_RESCHED 0.1
+#define P_CANCEL 0.1
+
+/* Restituisce un valore reale casuale in [0, 1) */
+static double randunif( void )
+{
+    return rand() / ((double)RAND_MAX + 1);
+}
+
+static double elapsed_since(clock_t tstart)
+{
+    return ((double)(clock() - tstart)) / CLOCKS_PER_SEC;
+}
+
+/* Restituisce un'entità casuale diversa da `e` */
+static int other_entity(int e, int n)
+{
+    return (e + 1 + rand() % (n - 1)) % n;
+}
+
+typedef struct {
+    int ent;
+} BenchEvent;
+
+static int *ent_id; /* ent_id[e] è l'id dell'evento dell'entità e */
+static int nent;
+static double checksum; /* somma degli istanti degli eventi eseguiti */
+
+static void bench_handler(EventSched *s, int id, void *payload)
+{
+    const int e = ((const BenchEvent*)payload)->ent;
+    const double now = eventsched_now(s);
+    const double u = randunif();
+
+    checksum += now;
+    if (u < P_RESCHED) {
+        const int j = other_entity(e, nent);
+        eventsched_reschedule(s, ent_id[j], now + 2*randunif());
+    } else if (u < P_RESCHED + P_CANCEL) {
+        BenchEvent ev;
+        ev.ent = other_entity(e, nent);
+        eventsched_cancel(s, ent_id[ev.ent]);
+        ent_id[ev.ent] = eventsched_schedule(s, now + 2*randunif(), bench_handler, &ev);
+    }
+    eventsched_reschedule(s, id, now + 2*randunif());
+}
+
+/* Esegue gli eventi fino all'istante `tmax`; restituisce il numero
+   di eventi eseguiti e scrive il tempo richiesto in `*elapsed` */
+static long run_eventsched(int n, double tmax, double *elapsed)
+{
+    EventSched *s = eventsched_create(n, sizeof(BenchEvent));
+    clock_t tstart;
+    BenchEvent ev;
+    long count;
+
+    srand(n);
+    checksum = 0.0;
+    for (ev.ent=0; ev.ent<n; ev.ent++) {
+        ent_id[ev.ent] = eventsched_schedule(s, 2*randunif(), bench_handler, &ev);
+    }
+    tstart = clock();
+    count = eventsched_run_until(s, tmax);
+    *elapsed = elapsed_since(tstart);
+    eventsched_destroy(s);
+    return count;
+}
+
+/* Lista ordinata per tempo; i nodi sono indicizzati dall'id
+   dell'evento, come nello scheduler basato su MinHeap */
+typedef struct {
+    int *next, *prev;
+    double *t;
+    int *ent;
+    int head;
+} EventList;
+
+/* Inserisce il nodo `id` con istante `t`, dopo tutti i nodi con
+   istante <= t */
+static void list_insert(EventList *l, int id, double t)
+{
+    int cur = l->head, last = -1;
+
+    while (cur != -1 && l->t[cur] <= t) {
+        last = cur;
+        cur = l->next[cur];
+    }
+    l->t[id] = t;
+    l->prev[id] = last;
+    l->next[id] = cur;
+    if (last == -1) {
+        l->head = id;
+    } else {
+        l->next[last] = id;
+    }
+    if (cur != -1) {
+        l->prev[cur] = id;
+    }
+}
+
+static void list_unlink(EventList *l, int id)
+{
+    if (l->prev[id] == -1) {
+        l->head = l->next[id];
+    } else {
+        l->next[l->prev[id]] = l->next[id];
+    }
+    if (l->next[id] != -1) {
+        l->prev[l->next[id]] = l->prev[id];
+    }
+}
+
+/* Come run_eventsched(), usando la lista ordinata. Poiché ogni
+   entità ha sempre esattamente un evento pendente, l'id dell'evento
+   coincide con l'entità. */
+static long run_list(int n, double tmax, double *elapsed)
+{
+    EventList l;
+    clock_t tstart;
+    long count = 0;
+    int e, j;
+
+    l.next = (int*)malloc(n * sizeof(*l.next));
+    l.prev = (int*)malloc(n * sizeof(*l.prev));
+    l.t = (double*)malloc(n * sizeof(*l.t));
+    l.ent = (int*)malloc(n * sizeof(*l.ent));
+    assert(l.next != NULL && l.prev != NULL && l.t != NULL && l.ent != NULL);
+    l.head = -1;
+    srand(n);
+    checksum = 0.0;
+    for (e=0; e<n; e++) {
+        l.ent[e] = e;
+        list_insert(&l, e, 2*randunif());
+    }
+    tstart = clock();
+    while (l.head != -1 && l.t[l.head] <= tmax) {
+        const int id = l.head;
+        const double now = l.t[id];
+        const double u = randunif();
+        e = l.ent[id];
+        list_unlink(&l, id);
+        checksum += now;
+        if (u < P_RESCHED + P_CANCEL) {
+            /* spostamento e cancellazione seguita da un nuovo
+               inserimento hanno lo stesso effetto sulla lista */
+            j = other_entity(e, n);
+            list_unlink(&l, j);
+            list_insert(&l, j, now + 2*randunif());
+        }
+        list_insert(&l, id, now + 2*randunif());
+        count++;
+    }
+    *elapsed = elapsed_since(tstart);
+    free(l.next);
+    free(l.prev);
+    free(l.t);
+    free(l.ent);
+    return count;
+}
+
+int main( int argc, char *argv[] )
+{
+    long nevents = 2000000, count;
+    int n;
+    double elapsed, sum;
+
+    if (argc > 2) {
+        fprintf(stderr, "Usage: %s [nevents]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 1) {
+        nevents = atol(argv[1]);
+    }
+
+    printf("%8s %14s %14s\n", "n", "MinHeap ev/s", "list ev/s");
+    for (n=10; n<=1000000; n*=10) {
+        ent_id = (int*)malloc(n * sizeof(*ent_id));
+        assert(ent_id != NULL);
+        nent = n;
+        /* ogni entità esegue in media un evento per unità di tempo */
+        count = run_eventsched(n, (double)nevents / n, &elapsed);
+        sum = checksum;
+        printf("%8d %14.0f", n, count / elapsed);
+        if (n <= 10000) {
+            const double tmax = (double)nevents / n / (n < 1000 ? 1 : n / 1000);
+            count = run_list(n, tmax, &elapsed);
+            printf(" %14.0f\n", count / elapsed);
+            if (tmax == (double)nevents / n)
+                assert(checksum == sum);
+        } else {
+            printf(" %14s\n", "-");
+        }
+        free(ent_id);
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ * eventsched-main.c -- Test scheduler per simulazioni ad eventi discreti
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Legge da file una sequenza di comandi e li esegue su uno
+   scheduler. Il primo valore è il numero massimo di eventi pendenti;
+   seguono i comandi:
+
+   - `s t tag`: programma un evento all'istante t con etichetta tag;
+   - `p t period tag`: programma un evento periodico, che viene
+     eseguito agli istanti t, t + period, t + 2*period, ...;
+   - `c id`: cancella l'evento id;
+   - `r id t`: sposta l'evento id all'istante t;
+   - `u t`: esegue gli eventi con istante <= t;
+   - `n`: stampa il tempo simulato e il numero di eventi pendenti.
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread minheap.c eventsched.c eventsched-main.c -o eventsched-main
+
+   Per eseguire:
+
+        ./eventsched-main eventsched.in */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "eventsched.h"
+
+typedef struct {
+    int tag;
+    double period; /* 0 per gli eventi non periodici */
+} Event;
+
+static void print_event(EventSched *s, int id, void *payload)
+{
+    const Event *e = (const Event*)payload;
+
+    printf("t=%f: event %d (tag %d)\n", eventsched_now(s), id, e->tag);
+    if (e->period > 0.0) {
+        eventsched_reschedule(s, id, eventsched_now(s) + e->period);
+    }
+}
+
+int main( int argc, char *argv[] )
+{
+    char op;
+    int n, id;
+    double t;
+    long count;
+    Event e;
+    EventSched *s;
+    FILE *filein = stdin;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s inputfile\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "-") != 0) {
+        filein = fopen(argv[1], "r");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (1 != fscanf(filein, "%d", &n)) {
+        fprintf(stderr, "Missing size\n");
+        return EXIT_FAILURE;
+    }
+    printf("eventsched_create(%d)\n", n);
+    s = eventsched_create(n, sizeof(Event));
+
+    while (1 == fscanf(filein, " %c", &op)) {
+        switch (op) {
+        case 's': /* schedule */
+            fscanf(filein, "%lf %d", &t, &e.tag);
+            e.period = 0.0;
+            id = eventsched_schedule(s, t, print_event, &e);
+            printf("eventsched_schedule(s, %f, tag %d) = %d\n", t, e.tag, id);
+            break;
+        case 'p': /* schedule periodic */
+            fscanf(filein, "%lf %lf %d", &t, &e.period, &e.tag);
+            id = eventsched_schedule(s, t, print_event, &e);
+            printf("eventsched_schedule(s, %f, tag %d, period %f) = %d\n", t, e.tag, e.period, id);
+            break;
+        case 'c': /* cancel */
+            fscanf(filein, "%d", &id);
+            printf("eventsched_cancel(s, %d)\n", id);
+            eventsched_cancel(s, id);
+            break;
+        case 'r': /* reschedule */
+            fscanf(filein, "%d %lf", &id, &t);
+            printf("eventsched_reschedule(s, %d, %f)\n", id, t);
+            eventsched_reschedule(s, id, t);
+            break;
+        case 'u': /* run until */
+            fscanf(filein, "%lf", &t);
+            printf("eventsched_run_until(s, %f)\n", t);
+            count = eventsched_run_until(s, t);
+            printf("%ld events executed\n", count);
+            break;
+        case 'n': /* now */
+            printf("now = %f, pending = %d\n", eventsched_now(s), eventsched_pending(s));
+            break;
+        default:
+            printf("Unknown command %c\n", op);
+            return EXIT_FAILURE;
+        }
+    }
+
+    eventsched_destroy(s);
+    if (filein != stdin) fclose(filein);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,224 @@
+/****************************************************************************
+ *
+ * eventsched.c -- Scheduler per simulazioni ad eventi discreti
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Scheduler per simulazioni ad eventi discreti
+% Ultimo aggiornamento: 2026-10-19
+
+In una simulazione ad eventi discreti lo stato del sistema cambia
+solo in corrispondenza di _eventi_, ciascuno associato ad un istante
+del tempo simulato; il nucleo del simulatore è uno _scheduler_ che
+mantiene l'insieme degli eventi futuri ed esegue ripetutamente quello
+con l'istante minimo, facendo avanzare il tempo simulato. L'esecuzione
+di un evento tipicamente programma nuovi eventi futuri, e spesso ne
+cancella o sposta altri (ad esempio un timeout che non serve più).
+
+Una realizzazione semplice mantiene gli eventi in una lista ordinata
+per tempo: l'estrazione del prossimo evento costa $O(1)$, ma
+l'inserimento richiede la scansione della lista e costa $O(n)$, dove
+$n$ è il numero di eventi pendenti. Qui invece gli eventi pendenti
+sono mantenuti in un `MinHeap`:
+
+- la chiave è l'_id_ dell'evento, un intero compreso tra 0 e
+  `size`-1; gli id liberi sono mantenuti in una pila, per cui un id
+  viene riutilizzato non appena l'evento corrispondente è stato
+  eseguito o cancellato;
+
+- la priorità è l'istante dell'evento.
+
+Poiché l'array `pos[]` dello heap consente di individuare un evento
+a partire dal suo id, la cancellazione (`minheap_remove()`) e lo
+spostamento di un evento (`minheap_change_prio()`) costano $O(\log
+n)$, come l'inserimento e l'estrazione del prossimo evento.
+
+I dati associati agli eventi (_payload_), tutti della stessa
+dimensione, si trovano in un unico array (_arena_) indicizzato
+dall'id: programmare un evento non richiede allocazioni di memoria.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread minheap.c eventsched.c eventsched-main.c -o eventsched-main
+
+Per eseguire in ambiente Linux/MacOSX:
+
+        ./eventsched-main eventsched.in
+
+## File
+
+- [eventsched.c](eventsched.c)
+- [eventsched.h](eventsched.h)
+- [eventsched-main.c](eventsched-main.c)
+- [eventsched-bench.c](eventsched-bench.c)
+- [eventsched.in](eventsched.in)
+
+***/
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "eventsched.h"
+
+EventSched *eventsched_create(int size, size_t payload_size)
+{
+    EventSched *s = (EventSched*)malloc(sizeof(*s));
+    int i;
+
+    assert(s != NULL);
+    assert(size > 0);
+
+    s->h = minheap_create(size);
+    s->handler = (EventHandler*)malloc(size * sizeof(*(s->handler)));
+    s->arena = (unsigned char*)malloc(payload_size > 0 ? size * payload_size : 1);
+    s->free_id = (int*)malloc(size * sizeof(*(s->free_id)));
+    assert(s->handler != NULL && s->arena != NULL && s->free_id != NULL);
+    s->payload_size = payload_size;
+    s->size = size;
+    /* l'id 0 è il primo ad essere assegnato */
+    for (i=0; i<size; i++) {
+        s->free_id[i] = size - 1 - i;
+    }
+    s->nfree = size;
+    s->running = -1;
+    s->now = 0.0;
+    return s;
+}
+
+void eventsched_destroy(EventSched *s)
+{
+    assert(s != NULL);
+
+    minheap_destroy(s->h);
+    free(s->handler);
+    free(s->arena);
+    free(s->free_id);
+    free(s);
+}
+
+int eventsched_schedule(EventSched *s, double t, EventHandler handler, const void *payload)
+{
+    int id;
+
+    assert(s != NULL);
+    assert(handler != NULL);
+    assert(t >= s->now);
+    assert(s->nfree > 0);
+
+    id = s->free_id[--(s->nfree)];
+    s->handler[id] = handler;
+    if (payload != NULL) {
+        memcpy(s->arena + id * s->payload_size, payload, s->payload_size);
+    } else {
+        memset(s->arena + id * s->payload_size, 0, s->payload_size);
+    }
+    minheap_insert(s->h, id, t);
+    return id;
+}
+
+void eventsched_cancel(EventSched *s, int id)
+{
+    assert(s != NULL);
+    assert(minheap_contains(s->h, id));
+
+    minheap_remove(s->h, id);
+    if (id != s->running) {
+        s->free_id[s->nfree++] = id;
+    }
+}
+
+void eventsched_reschedule(EventSched *s, int id, double t)
+{
+    assert(s != NULL);
+    assert(t >= s->now);
+
+    if (minheap_contains(s->h, id)) {
+        minheap_change_prio(s->h, id, t);
+    } else {
+        /* l'evento in esecuzione viene programmato nuovamente */
+        assert(id == s->running);
+        minheap_insert(s->h, id, t);
+    }
+}
+
+long eventsched_run_until(EventSched *s, double t)
+{
+    long count = 0;
+    int id;
+
+    assert(s != NULL);
+    assert(s->running == -1);
+
+    while (!minheap_is_empty(s->h) && minheap_min_prio(s->h) <= t) {
+        s->now = minheap_min_prio(s->h);
+        id = minheap_delete_min(s->h);
+        s->running = id;
+        s->handler[id](s, id, s->arena + id * s->payload_size);
+        s->running = -1;
+        /* l'id viene liberato, a meno che l'evento non sia stato
+           programmato nuovamente */
+        if (!minheap_contains(s->h, id)) {
+            s->free_id[s->nfree++] = id;
+        }
+        count++;
+    }
+    /* la simulazione è arrivata fino all'istante t, anche se
+       l'ultimo evento eseguito lo precede: da qui in avanti non si
+       possono programmare eventi prima di t */
+    if (t > s->now) {
+        s->now = t;
+    }
+    return count;
+}
+
+double eventsched_now(const EventSched *s)
+{
+    assert(s != NULL);
+
+    return s->now;
+}
+
+int eventsched_pending(const EventSched *s)
+{
+    assert(s != NULL);
+
+    return minheap_get_n(s->h);
+}
+
+int eventsched_is_pending(const EventSched *s, int id)
+{
+    assert(s != NULL);
+
+    return minheap_contains(s->h, id);
+}
+
+double eventsched_time(const EventSched *s, int id)
+{
+    assert(eventsched_is_pending(s, id));
+
+    return minheap_get_prio(s->h, id);
+}
+
+void *eventsched_payload(const EventSched *s, int id)
+{
+    assert(s != NULL);
+    assert(id >= 0 && id < s->size);
+
+    return s->arena + id * s->payload_size;
+}
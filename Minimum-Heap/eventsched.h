@@ -0,0 +1,109 @@
+/****************************************************************************
+ *
+ * eventsched.h -- Interfaccia scheduler per simulazioni ad eventi discreti
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef EVENTSCHED_H
+#define EVENTSCHED_H
+
+#include <stddef.h>
+#include "minheap.h"
+
+struct EventSched;
+
+/* Funzione invocata quando viene eseguito l'evento `id`; `payload`
+   punta ai dati associati all'evento, che restano validi fino al
+   termine della funzione. La funzione può programmare, cancellare o
+   riprogrammare altri eventi, e può riprogrammare lo stesso evento
+   `id` con `eventsched_reschedule()` (ad esempio per eventi
+   periodici). */
+typedef void (*EventHandler)(struct EventSched *s, int id, void *payload);
+
+typedef struct EventSched {
+    MinHeap *h; /* eventi pendenti: chiave = id, prio = istante */
+    EventHandler *handler; /* handler[id] è la funzione dell'evento id */
+    unsigned char *arena; /* dati degli eventi: payload_size byte per id */
+    size_t payload_size; /* dimensione dei dati di un evento */
+    int *free_id; /* pila degli id liberi */
+    int nfree; /* numero di id liberi */
+    int size; /* gli id sono gli interi 0 .. size-1 */
+    int running; /* id dell'evento in esecuzione, -1 se nessuno */
+    double now; /* tempo simulato corrente */
+} EventSched;
+
+/* Crea uno scheduler vuoto, con tempo simulato 0, che può contenere
+   al più `size` eventi pendenti; ogni evento ha `payload_size` byte
+   di dati (anche 0).
+
+   Precondizione: size > 0 */
+EventSched *eventsched_create(int size, size_t payload_size);
+
+/* Dealloca lo scheduler e tutti gli eventi pendenti */
+void eventsched_destroy(EventSched *s);
+
+/* Programma l'evento `handler` all'istante `t`, copiandone i dati da
+   `payload` (che può essere NULL: in tal caso i dati vengono
+   azzerati). Restituisce l'id dell'evento. Gli id vengono riciclati:
+   quando un evento viene eseguito o cancellato il suo id può essere
+   assegnato ad un nuovo evento. Costo O(log n).
+
+   Precondizioni: t >= eventsched_now(s), meno di `size` eventi
+   pendenti */
+int eventsched_schedule(EventSched *s, double t, EventHandler handler, const void *payload);
+
+/* Cancella l'evento pendente `id`. Costo O(log n).
+
+   Precondizione: l'evento `id` è pendente */
+void eventsched_cancel(EventSched *s, int id);
+
+/* Sposta l'evento `id` all'istante `t`; `id` deve essere pendente,
+   oppure essere l'evento in esecuzione (che viene così programmato
+   nuovamente, mantenendo id e dati). Costo O(log n).
+
+   Precondizione: t >= eventsched_now(s) */
+void eventsched_reschedule(EventSched *s, int id, double t);
+
+/* Esegue, in ordine di tempo, tutti gli eventi con istante <= t,
+   compresi quelli programmati durante l'esecuzione; il tempo
+   simulato corrente diventa l'istante di ciascun evento prima di
+   invocarne la funzione. Eventi con lo stesso istante vengono
+   eseguiti in un ordine non specificato. Al termine il tempo
+   simulato corrente diventa t (se t è maggiore del tempo corrente),
+   per cui non si possono più programmare eventi in istanti
+   precedenti. Restituisce il numero di eventi eseguiti. */
+long eventsched_run_until(EventSched *s, double t);
+
+/* Restituisce il tempo simulato corrente, cioè l'istante dell'ultimo
+   evento eseguito (0 se nessun evento è stato eseguito) */
+double eventsched_now(const EventSched *s);
+
+/* Restituisce il numero di eventi pendenti */
+int eventsched_pending(const EventSched *s);
+
+/* Restituisce 1 se e solo se l'evento `id` è pendente */
+int eventsched_is_pending(const EventSched *s, int id);
+
+/* Restituisce l'istante dell'evento pendente `id` */
+double eventsched_time(const EventSched *s, int id);
+
+/* Restituisce il puntatore ai dati dell'evento `id`, pendente o in
+   esecuzione */
+void *eventsched_payload(const EventSched *s, int id);
+
+#endif
@@ -0,0 +1,103 @@
+/****************************************************************************
+ *
+ * hashheap-main.c -- Test del Min-Heap con chiavi a 64 bit
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "hashheap.h"
+
+int main( int argc, char *argv[] )
+{
+    char op;
+    int64_t key;
+    double prio;
+    HashHeap *h;
+    FILE *filein = stdin;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s inputfile\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "-") != 0) {
+        filein = fopen(argv[1], "r");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* la dimensione all'inizio del file viene ignorata, dato che
+       HashHeap non ha una capienza massima */
+    if (1 != fscanf(filein, "%" SCNd64, &key)) {
+        fprintf(stderr, "Missing size\n");
+        return EXIT_FAILURE;
+    }
+    printf("hashheap_create()\n");
+    h = hashheap_create();
+
+    while (1 == fscanf(filein, " %c", &op)) {
+        switch (op) {
+        case '+': /* insert */
+            fscanf(filein, "%" SCNd64 " %lf", &key, &prio);
+            printf("hashheap_insert(h, %" PRId64 ", %f)\n", key, prio);
+            hashheap_insert(h, key, prio);
+            break;
+        case '-': /* delete min */
+            key = hashheap_delete_min(h);
+            printf("hashheap_delete_min(h) = %" PRId64 "\n", key);
+            break;
+        case '?': /* get min */
+            key = hashheap_min(h);
+            printf("hashheap_min(h) = %" PRId64 "\n", key);
+            break;
+        case 'c': /* change prio */
+            fscanf(filein, "%" SCNd64 " %lf", &key, &prio);
+            printf("hashheap_change_prio(h, %" PRId64 ", %f)\n", key, prio);
+            hashheap_change_prio(h, key, prio);
+            break;
+        case 'r': /* remove */
+            fscanf(filein, "%" SCNd64, &key);
+            printf("hashheap_remove(h, %" PRId64 ")\n", key);
+            hashheap_remove(h, key);
+            break;
+        case 'k': /* contains */
+            fscanf(filein, "%" SCNd64, &key);
+            printf("hashheap_contains(h, %" PRId64 ") = %d\n", key, hashheap_contains(h, key));
+            break;
+        case 's': /* get n of elements */
+            printf("hashheap_get_n(h) = %d\n", hashheap_get_n(h));
+            break;
+        case 'p': /* print */
+            hashheap_print(h);
+            break;
+        default:
+            printf("Unknown command %c\n", op);
+            return EXIT_FAILURE;
+        }
+    }
+
+    hashheap_destroy(h);
+    if (filein != stdin) fclose(filein);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,385 @@
+/****************************************************************************
+ *
+ * hashheap.c -- Min-Heap con chiavi a 64 bit
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Min-Heap con chiavi a 64 bit
+% Ultimo aggiornamento: 2026-10-19
+
+Il min-heap definito in [minheap.c](minheap.c) richiede che le chiavi
+siano gli interi $0, \ldots, \mathit{size}-1$, e alloca l'array
+`pos[]` per tutte le possibili chiavi al momento della creazione.
+Se le chiavi sono identificatori arbitrari (ad esempio a 64 bit),
+l'universo delle chiavi è troppo grande per questo approccio.
+
+`HashHeap` è un min-heap binario con le stesse operazioni, in cui:
+
+- le chiavi sono interi arbitrari di tipo `int64_t`;
+
+- l'array `heap[]` non ha una capienza massima: quando è pieno la sua
+  dimensione viene raddoppiata, per cui il costo ammortizzato di un
+  inserimento resta $O(\log n)$;
+
+- la posizione di ciascuna chiave nello heap (il ruolo svolto da
+  `pos[]` in `MinHeap`) è memorizzata in una tabella hash ad
+  indirizzamento aperto con scansione lineare. La tabella ha un
+  numero di celle pari ad una potenza di due, almeno doppio rispetto
+  al numero di chiavi presenti, e viene anch'essa raddoppiata quando
+  necessario. Le cancellazioni non lasciano "lapidi": gli elementi
+  successivi della stessa sequenza di scansione vengono spostati
+  indietro (_backward shift deletion_), per cui la lunghezza media
+  delle scansioni resta costante.
+
+Ad ogni scambio tra due elementi dello heap occorre aggiornare la
+posizione delle due chiavi nella tabella hash; l'elemento da spostare
+viene individuato una sola volta all'inizio di `move_up()` e
+`move_down()`, e il suo indice nella tabella viene aggiornato solo
+al termine.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic hashheap.c hashheap-main.c -o hashheap-main
+
+Per eseguire:
+
+        ./hashheap-main inputfile
+
+dove `inputfile` contiene gli stessi comandi accettati da
+[minheap-main.c](minheap-main.c) (esclusi `b`, `i` e `d`), con
+chiavi a 64 bit.
+
+## File
+
+- [hashheap.c](hashheap.c)
+- [hashheap.h](hashheap.h)
+- [hashheap-main.c](hashheap-main.c)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <inttypes.h>
+#include "hashheap.h"
+
+/* Capienza iniziale di heap[] */
+#define HASHHEAP_INIT_CAPACITY 16
+
+/* Funzione di supporto: mescola i bit della chiave (funzione di
+   finalizzazione di SplitMix64), in modo che chiavi "vicine" siano
+   assegnate a celle lontane della tabella */
+static uint64_t hash64(int64_t key)
+{
+    uint64_t x = (uint64_t)key;
+
+    x ^= x >> 30;
+    x *= (((uint64_t)0xbf58476dUL) << 32) | 0x1ce4e5b9UL;
+    x ^= x >> 27;
+    x *= (((uint64_t)0x94d049bbUL) << 32) | 0x133111ebUL;
+    x ^= x >> 31;
+    return x;
+}
+
+/* Funzione di supporto: restituisce l'indice della cella di table[]
+   che contiene `key`, oppure della cella vuota in cui andrebbe
+   inserita */
+static int find_slot(const HashHeap *h, int64_t key)
+{
+    const int mask = h->table_size - 1;
+    int s = (int)(hash64(key) & (uint64_t)mask);
+
+    while (h->table[s].pos != -1 && h->table[s].key != key) {
+        s = (s + 1) & mask;
+    }
+    return s;
+}
+
+/* Funzione di supporto: alloca una tabella vuota di `size` celle */
+static HashSlot *alloc_table(int size)
+{
+    HashSlot *t = (HashSlot*)malloc(size * sizeof(*t));
+    int i;
+
+    assert(t != NULL);
+    for (i=0; i<size; i++) {
+        t[i].pos = -1;
+    }
+    return t;
+}
+
+/* Funzione di supporto: raddoppia la dimensione di table[],
+   reinserendo tutte le chiavi presenti nello heap */
+static void grow_table(HashHeap *h)
+{
+    int i;
+
+    free(h->table);
+    h->table_size *= 2;
+    h->table = alloc_table(h->table_size);
+    for (i=0; i<h->n; i++) {
+        const int s = find_slot(h, h->heap[i].key);
+        h->table[s].key = h->heap[i].key;
+        h->table[s].pos = i;
+    }
+}
+
+/* Funzione di supporto: svuota la cella `s` di table[], spostando
+   indietro gli elementi successivi della stessa sequenza di scansione
+   che altrimenti non sarebbero più raggiungibili */
+static void erase_slot(HashHeap *h, int s)
+{
+    const int mask = h->table_size - 1;
+    int j = s, home;
+
+    while (1) {
+        h->table[s].pos = -1;
+        do {
+            j = (j + 1) & mask;
+            if (h->table[j].pos == -1) {
+                return;
+            }
+            home = (int)(hash64(h->table[j].key) & (uint64_t)mask);
+            /* l'elemento in j può essere spostato in s se la sua
+               cella "naturale" non si trova nell'intervallo
+               circolare (s, j] */
+        } while (s <= j ? (s < home && home <= j) : (s < home || home <= j));
+        h->table[s] = h->table[j];
+        s = j;
+    }
+}
+
+/* Funzione di supporto: restituisce il puntatore alla posizione di
+   `key` nello heap (che deve essere presente) */
+static int *pos_of(HashHeap *h, int64_t key)
+{
+    const int s = find_slot(h, key);
+
+    assert(h->table[s].pos != -1);
+    return &(h->table[s].pos);
+}
+
+HashHeap *hashheap_create( void )
+{
+    HashHeap *h = (HashHeap*)malloc(sizeof(*h));
+
+    assert(h != NULL);
+    h->n = 0;
+    h->capacity = HASHHEAP_INIT_CAPACITY;
+    h->heap = (HashElem*)malloc(h->capacity * sizeof(*(h->heap)));
+    assert(h->heap != NULL);
+    h->table_size = 2 * HASHHEAP_INIT_CAPACITY;
+    h->table = alloc_table(h->table_size);
+    return h;
+}
+
+void hashheap_clear(HashHeap *h)
+{
+    int i;
+
+    assert(h != NULL);
+
+    for (i=0; i<h->table_size; i++) {
+        h->table[i].pos = -1;
+    }
+    h->n = 0;
+}
+
+void hashheap_destroy(HashHeap *h)
+{
+    assert(h != NULL);
+
+    free(h->heap);
+    free(h->table);
+    free(h);
+}
+
+int hashheap_is_empty(const HashHeap *h)
+{
+    assert(h != NULL);
+
+    return (h->n == 0);
+}
+
+int hashheap_get_n(const HashHeap *h)
+{
+    assert(h != NULL);
+
+    return h->n;
+}
+
+int64_t hashheap_min(const HashHeap *h)
+{
+    assert( !hashheap_is_empty(h) );
+
+    return h->heap[0].key;
+}
+
+double hashheap_min_prio(const HashHeap *h)
+{
+    assert( !hashheap_is_empty(h) );
+
+    return h->heap[0].prio;
+}
+
+int hashheap_contains(const HashHeap *h, int64_t key)
+{
+    assert(h != NULL);
+
+    return (h->table[find_slot(h, key)].pos != -1);
+}
+
+/* Funzione di supporto: sposta verso l'alto l'elemento in posizione
+   `i`, il cui indice nella tabella hash è `*pos`. Gli elementi
+   incontrati vengono spostati verso il basso senza scambi, e
+   l'elemento viene scritto una sola volta nella posizione finale. */
+static void move_up(HashHeap *h, int i, int *pos)
+{
+    const HashElem e = h->heap[i];
+    int p;
+
+    while (i > 0 && e.prio < h->heap[p = (i-1)/2].prio) {
+        h->heap[i] = h->heap[p];
+        *pos_of(h, h->heap[i].key) = i;
+        i = p;
+    }
+    h->heap[i] = e;
+    *pos = i;
+}
+
+/* Funzione di supporto: sposta verso il basso l'elemento in posizione
+   `i`, come move_up() */
+static void move_down(HashHeap *h, int i, int *pos)
+{
+    const HashElem e = h->heap[i];
+    int c;
+
+    while ((c = 2*i + 1) < h->n) {
+        if (c+1 < h->n && h->heap[c+1].prio < h->heap[c].prio) {
+            c++;
+        }
+        if (h->heap[c].prio >= e.prio) {
+            break;
+        }
+        h->heap[i] = h->heap[c];
+        *pos_of(h, h->heap[i].key) = i;
+        i = c;
+    }
+    h->heap[i] = e;
+    *pos = i;
+}
+
+void hashheap_insert(HashHeap *h, int64_t key, double prio)
+{
+    int s;
+
+    assert(h != NULL);
+    assert( !hashheap_contains(h, key) );
+
+    if (h->n == h->capacity) {
+        h->capacity *= 2;
+        h->heap = (HashElem*)realloc(h->heap, h->capacity * sizeof(*(h->heap)));
+        assert(h->heap != NULL);
+    }
+    if (2*(h->n + 1) > h->table_size) {
+        grow_table(h);
+    }
+    s = find_slot(h, key);
+    h->table[s].key = key;
+    h->heap[h->n].key = key;
+    h->heap[h->n].prio = prio;
+    h->n++;
+    move_up(h, h->n - 1, &(h->table[s].pos));
+}
+
+/* Funzione di supporto: rimuove l'elemento in posizione `i`, la cui
+   chiave si trova nella cella `s` della tabella */
+static void remove_at(HashHeap *h, int i, int s)
+{
+    const double prio = h->heap[i].prio;
+    int *pos;
+
+    erase_slot(h, s);
+    h->n--;
+    if (i < h->n) {
+        h->heap[i] = h->heap[h->n];
+        pos = pos_of(h, h->heap[i].key);
+        if (h->heap[i].prio < prio) {
+            move_up(h, i, pos);
+        } else {
+            move_down(h, i, pos);
+        }
+    }
+}
+
+int64_t hashheap_delete_min(HashHeap *h)
+{
+    const int64_t ret = hashheap_min(h);
+
+    remove_at(h, 0, find_slot(h, ret));
+    return ret;
+}
+
+void hashheap_remove(HashHeap *h, int64_t key)
+{
+    const int s = find_slot(h, key);
+
+    assert(h->table[s].pos != -1);
+    remove_at(h, h->table[s].pos, s);
+}
+
+void hashheap_change_prio(HashHeap *h, int64_t key, double newprio)
+{
+    int *pos;
+    double oldprio;
+
+    assert(h != NULL);
+
+    pos = pos_of(h, key);
+    oldprio = h->heap[*pos].prio;
+    h->heap[*pos].prio = newprio;
+    if (newprio < oldprio) {
+        move_up(h, *pos, pos);
+    } else {
+        move_down(h, *pos, pos);
+    }
+}
+
+void hashheap_print(const HashHeap *h)
+{
+    int i, j, width = 1;
+
+    assert(h != NULL);
+
+    printf("\n** Contenuto dello heap:\n\n");
+    printf("n=%d capacity=%d table_size=%d\n", h->n, h->capacity, h->table_size);
+    printf("Contenuto dell'array heap[] (stampato a livelli):\n");
+    i = 0;
+    while (i < h->n) {
+        j = 0;
+        while (j<width && i < h->n) {
+            printf("h[%2d]=(%" PRId64 ", %6.2f) ", i, h->heap[i].key, h->heap[i].prio);
+            i++;
+            j++;
+        }
+        printf("\n");
+        width *= 2;
+    }
+    printf("\n\n** Fine contenuto dello heap\n\n");
+}
@@ -0,0 +1,103 @@
+/****************************************************************************
+ *
+ * hashheap.h -- Interfaccia Min-Heap con chiavi a 64 bit
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef HASHHEAP_H
+#define HASHHEAP_H
+
+#include <stdint.h>
+
+typedef struct {
+    int64_t key;
+    double prio;
+} HashElem;
+
+/* Elemento dell'indice hash: la chiave `key` si trova in posizione
+   `pos` dello heap; pos == -1 indica una cella vuota */
+typedef struct {
+    int64_t key;
+    int pos;
+} HashSlot;
+
+typedef struct {
+    HashElem *heap; /* heap[0..n-1] contiene le coppie (chiave, prio) */
+    int n; /* quante coppie (chiave, prio) sono presenti nello heap */
+    int capacity; /* dimensione dell'array heap[] */
+    HashSlot *table; /* indice hash (indirizzamento aperto) */
+    int table_size; /* numero di celle di table[], potenza di due */
+} HashHeap;
+
+/* Crea uno heap vuoto. A differenza di `minheap_create()` non occorre
+   indicare la capienza: la memoria viene estesa quando necessario. Le
+   chiavi possono essere interi arbitrari a 64 bit; ogni chiave può
+   essere presente nello heap al più una volta. */
+HashHeap *hashheap_create( void );
+
+/* Svuota lo heap */
+void hashheap_clear(HashHeap *h);
+
+/* Dealloca la memoria occupata dallo heap h e dal suo contenuto */
+void hashheap_destroy(HashHeap *h);
+
+/* Restituisce 1 se e solo se lo heap è vuoto */
+int hashheap_is_empty(const HashHeap *h);
+
+/* Ritorna il numero di elementi effettivamente presenti nello heap */
+int hashheap_get_n(const HashHeap *h);
+
+/* Restituisce la chiave associata alla minima priorità; non modifica
+   lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int64_t hashheap_min(const HashHeap *h);
+
+/* Restituisce la minima priorità; non modifica lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+double hashheap_min_prio(const HashHeap *h);
+
+/* Inserisce una nuova chiave `key` con priorità `prio`.
+
+   Precondizione: `key` non deve essere già presente nello heap. */
+void hashheap_insert(HashHeap *h, int64_t key, double prio);
+
+/* Rimuove dallo heap la coppia (chiave, prio) con priorità minima, e
+   restituisce la chiave di tale coppia.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int64_t hashheap_delete_min(HashHeap *h);
+
+/* Modifica la priorità associata alla chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+void hashheap_change_prio(HashHeap *h, int64_t key, double new_prio);
+
+/* Restituisce 1 se e solo se la chiave `key` è presente nello heap */
+int hashheap_contains(const HashHeap *h, int64_t key);
+
+/* Rimuove dallo heap la coppia (chiave, prio) di chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+void hashheap_remove(HashHeap *h, int64_t key);
+
+/* Stampa il contenuto dello heap */
+void hashheap_print(const HashHeap *h);
+
+#endif
@@ -0,0 +1,525 @@
+/****************************************************************************
+ *
+ * minheap-bench.c -- Misure delle prestazioni del Min-Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Confronta le prestazioni di MinHeap e delle altre code di priorità
+   di questa cartella. Le misure sono suddivise nelle sezioni seguenti,
+   nello stesso ordine in cui vengono stampate:
+
+   - heap con diversi valori di arity: sequenze di operazioni in cui
+     domina `minheap_delete_min()` (modello "hold" e svuotamento);
+
+   - "build": costruzione di uno heap di n elementi con n inserimenti,
+     con `minheap_build()` e con `minheap_build_parallel()`;
+
+   - "hold": modello "hold" eseguito un elemento alla volta e a
+     gruppi di B elementi (`minheap_delete_min_k()` e
+     `minheap_insert_batch()`), e con `HashHeap` (chiavi a 64 bit, si
+     veda hashheap.c);
+
+   - "decrease-key": MinHeap, pairing heap (pairheap.c) e radix heap
+     (radixheap.c) su una sequenza simile a quella dell'algoritmo di
+     Dijkstra, in cui prevalgono le riduzioni di priorità;
+
+   - "priorities in a window": MinHeap, coda a bucket (bucketqueue.c)
+     e calendar queue (calqueue.c) con priorità comprese in una
+     finestra ristretta;
+
+   - "bounded buffer": min-max heap (minmaxheap.c) e coppia di MinHeap
+     in un buffer di capienza limitata.
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread minheap.c hashheap.c pairheap.c radixheap.c bucketqueue.c calqueue.c minmaxheap.c minheap-bench.c -lm -o minheap-bench
+
+   oppure, per la disposizione in memoria SoA (si veda minheap.h):
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread -DMINHEAP_SOA minheap.c hashheap.c pairheap.c radixheap.c bucketqueue.c calqueue.c minmaxheap.c minheap-bench.c -lm -o minheap-bench-soa
+
+   Analogamente, -DMINHEAP_BHEAP seleziona la disposizione B-heap.
+
+   Per eseguire:
+
+        ./minheap-bench [n]
+
+   dove `n` (default 1000000) è il numero di elementi nello heap. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <assert.h>
+#include "minheap.h"
+#include "hashheap.h"
+#include "pairheap.h"
+#include "radixheap.h"
+#include "bucketqueue.h"
+#include "calqueue.h"
+#include "minmaxheap.h"
+
+#ifdef MINHEAP_BHEAP
+#define LAYOUT_BHEAP " B-heap"
+#else
+#define LAYOUT_BHEAP ""
+#endif
+
+/* Restituisce un valore reale casuale in [0, 1) */
+static double randunif( void )
+{
+    return rand() / ((double)RAND_MAX + 1);
+}
+
+static double elapsed_since(clock_t tstart)
+{
+    return ((double)(clock() - tstart)) / CLOCKS_PER_SEC;
+}
+
+/* Modello "hold": lo heap contiene n elementi; ciascuna delle m
+   operazioni estrae il minimo e reinserisce la stessa chiave con una
+   priorità maggiore di quella estratta, come in una simulazione ad
+   eventi discreti. Restituisce il tempo impiegato. */
+static double bench_hold(MinHeap *h, const double *prio, int n, int m)
+{
+    clock_t tstart = clock();
+    double now = 0.0;
+    int i, key;
+
+    for (i=0; i<n; i++) {
+        minheap_insert(h, i, prio[i]);
+    }
+    for (i=0; i<m; i++) {
+        key = minheap_min(h);
+        now = minheap_min_prio(h);
+        minheap_delete_min(h);
+        minheap_insert(h, key, now + prio[i % n]);
+    }
+    minheap_clear(h);
+    return elapsed_since(tstart);
+}
+
+/* Verifica che estraendo tutti gli elementi di h le priorità siano
+   in ordine non decrescente, e che gli elementi siano n */
+static void check_drain(MinHeap *h, int n)
+{
+    double last = -1.0;
+    int i;
+
+    assert(minheap_get_n(h) == n);
+    for (i=0; i<n; i++) {
+        const double p = minheap_min_prio(h);
+        assert(p >= last);
+        last = p;
+        minheap_delete_min(h);
+    }
+    assert(minheap_is_empty(h));
+}
+
+/* Costruisce uno heap con le n coppie (i, prio[i]) usando n
+   inserimenti (nthreads = 0), `minheap_build()` (nthreads = 1)
+   oppure `minheap_build_parallel()`. Restituisce il tempo impiegato
+   dalla sola costruzione. */
+static double bench_build(MinHeap *h, const int *keys, const double *prio, int n, int nthreads)
+{
+    clock_t tstart;
+    double elapsed;
+    int i;
+
+    tstart = clock();
+    if (nthreads == 0) {
+        for (i=0; i<n; i++) {
+            minheap_insert(h, keys[i], prio[i]);
+        }
+    } else {
+        minheap_build_parallel(h, keys, prio, n, nthreads);
+    }
+    elapsed = elapsed_since(tstart);
+    check_drain(h, n);
+    return elapsed;
+}
+
+/* Come bench_hold(), ma ogni passo estrae le B coppie di priorità
+   minima con minheap_delete_min_k() e le reinserisce con
+   minheap_insert_batch(). */
+static double bench_hold_batch(MinHeap *h, const double *prio, int n, int m, int B)
+{
+    clock_t tstart = clock();
+    int *keys = (int*)malloc(B * sizeof(*keys));
+    double *p = (double*)malloc(B * sizeof(*p));
+    int i, j, k;
+
+    assert(keys != NULL && p != NULL);
+    for (i=0; i<n; i++) {
+        minheap_insert(h, i, prio[i]);
+    }
+    for (i=0; i<m; i+=B) {
+        k = minheap_delete_min_k(h, B, keys, p);
+        for (j=0; j<k; j++) {
+            p[j] += prio[(i + j) % n];
+        }
+        minheap_insert_batch(h, keys, p, k);
+    }
+    minheap_clear(h);
+    free(keys);
+    free(p);
+    return elapsed_since(tstart);
+}
+
+/* Come bench_hold(), usando HashHeap; le chiavi sono interi a 64 bit
+   sparsi (i moltiplicato per una costante dispari) */
+static double bench_hold_hash(const double *prio, int n, int m)
+{
+    clock_t tstart = clock();
+    HashHeap *h = hashheap_create();
+    const uint64_t mult = (((uint64_t)0x9E3779B9UL) << 32) | 0x7F4A7C15UL;
+    double now = 0.0;
+    int64_t key;
+    int i;
+
+    for (i=0; i<n; i++) {
+        hashheap_insert(h, (int64_t)(i * mult), prio[i]);
+    }
+    for (i=0; i<m; i++) {
+        key = hashheap_min(h);
+        now = hashheap_min_prio(h);
+        hashheap_delete_min(h);
+        hashheap_insert(h, key, now + prio[i % n]);
+    }
+    assert(hashheap_get_n(h) == n);
+    hashheap_destroy(h);
+    return elapsed_since(tstart);
+}
+
+/* Numero di riduzioni di priorità dopo ogni estrazione in
+   bench_decrease() */
+#define DECREASES_PER_DELETE 8
+
+/* Strutture confrontate da bench_decrease() */
+enum { ENGINE_MINHEAP, ENGINE_PAIRHEAP, ENGINE_RADIXHEAP, ENGINE_BUCKETQUEUE, ENGINE_CALQUEUE, ENGINE_MINMAXHEAP };
+
+/* Inserisce n elementi, poi li estrae tutti; dopo ogni estrazione
+   riduce la priorità di DECREASES_PER_DELETE chiavi casuali ancora
+   presenti, senza scendere sotto la priorità appena estratta (come
+   avviene nell'algoritmo di Dijkstra). Le priorità sono interi, in
+   modo che si possa usare anche RadixHeap; la sequenza di numeri
+   casuali dipende solo da n, per cui tutte le strutture eseguono le
+   stesse operazioni. */
+static double bench_decrease(const double *prio, int n, int engine)
+{
+    clock_t tstart = clock();
+    MinHeap *mh = NULL;
+    PairPool *pool = NULL;
+    PairHeap *ph = NULL;
+    RadixHeap *rh = NULL;
+    double now = 0.0, p;
+    int i, j, key, left = n;
+
+    switch (engine) {
+    case ENGINE_MINHEAP: mh = minheap_create(n); break;
+    case ENGINE_PAIRHEAP: pool = pairpool_create(n); ph = pairheap_create(pool); break;
+    default: rh = radixheap_create(n);
+    }
+    srand(7);
+    for (i=0; i<n; i++) {
+        p = floor(prio[i] * 1e9);
+        switch (engine) {
+        case ENGINE_MINHEAP: minheap_insert(mh, i, p); break;
+        case ENGINE_PAIRHEAP: pairheap_insert(ph, i, p); break;
+        default: radixheap_insert(rh, i, (uint64_t)p);
+        }
+    }
+    while (left > 0) {
+        switch (engine) {
+        case ENGINE_MINHEAP:
+            now = minheap_min_prio(mh);
+            minheap_delete_min(mh);
+            break;
+        case ENGINE_PAIRHEAP:
+            now = pairheap_min_prio(ph);
+            pairheap_delete_min(ph);
+            break;
+        default:
+            radixheap_delete_min(rh);
+            now = (double)radixheap_last(rh);
+        }
+        left--;
+        for (j=0; j<DECREASES_PER_DELETE && left>0; j++) {
+            key = rand() % n;
+            p = now + floor(randunif() * 1e7);
+            switch (engine) {
+            case ENGINE_MINHEAP:
+                if (minheap_contains(mh, key) && p < minheap_get_prio(mh, key)) {
+                    minheap_change_prio(mh, key, p);
+                }
+                break;
+            case ENGINE_PAIRHEAP:
+                if (pairheap_contains(ph, key) && p < pairheap_get_prio(ph, key)) {
+                    pairheap_change_prio(ph, key, p);
+                }
+                break;
+            default:
+                if (radixheap_contains(rh, key) && (uint64_t)p < radixheap_get_prio(rh, key)) {
+                    radixheap_change_prio(rh, key, (uint64_t)p);
+                }
+            }
+        }
+    }
+    switch (engine) {
+    case ENGINE_MINHEAP: minheap_destroy(mh); break;
+    case ENGINE_PAIRHEAP: pairheap_destroy(ph); pairpool_destroy(pool); break;
+    default: radixheap_destroy(rh);
+    }
+    return elapsed_since(tstart);
+}
+
+/* Ampiezza della finestra delle priorità in bench_window() */
+#define WINDOW 1000
+
+/* Modello "hold" con priorità in una finestra ristretta, come in una
+   coda di timeout: ogni nuova priorità supera quella estratta di meno
+   di WINDOW. Confronta MinHeap, BucketQueue e CalQueue. Le priorità
+   vengono arrotondate all'intero inferiore solo per BucketQueue: la
+   coda a calendario è pensata per tempi reali, e con molti eventi
+   aventi lo stesso tempo intero le liste dei bucket si allungano. */
+static double bench_window(const double *prio, int n, int m, int engine)
+{
+    clock_t tstart = clock();
+    MinHeap *mh = NULL;
+    BucketQueue *bq = NULL;
+    CalQueue *cq = NULL;
+    double now = 0.0;
+    int i, key = 0;
+
+    switch (engine) {
+    case ENGINE_MINHEAP: mh = minheap_create(n); break;
+    case ENGINE_BUCKETQUEUE: bq = bucketqueue_create(n, WINDOW); break;
+    default: cq = calqueue_create(n);
+    }
+    for (i=0; i<n+m; i++) {
+        double p;
+        if (i >= n) {
+            switch (engine) {
+            case ENGINE_MINHEAP:
+                now = minheap_min_prio(mh);
+                key = minheap_delete_min(mh);
+                break;
+            case ENGINE_BUCKETQUEUE:
+                now = (double)bucketqueue_min_prio(bq);
+                key = bucketqueue_delete_min(bq);
+                break;
+            default:
+                now = calqueue_min_prio(cq);
+                key = calqueue_delete_min(cq);
+            }
+        } else {
+            key = i;
+        }
+        p = now + prio[i % n] * WINDOW;
+        if (engine == ENGINE_BUCKETQUEUE) {
+            p = floor(p);
+        }
+        switch (engine) {
+        case ENGINE_MINHEAP: minheap_insert(mh, key, p); break;
+        case ENGINE_BUCKETQUEUE: bucketqueue_insert(bq, key, (int64_t)p); break;
+        default: calqueue_insert(cq, key, p);
+        }
+    }
+    switch (engine) {
+    case ENGINE_MINHEAP: minheap_destroy(mh); break;
+    case ENGINE_BUCKETQUEUE: bucketqueue_destroy(bq); break;
+    default: calqueue_destroy(cq);
+    }
+    return elapsed_since(tstart);
+}
+
+/* Buffer di capienza limitata `cap` che riceve m coppie con
+   priorità casuali: quando è pieno, una nuova coppia migliore (cioè
+   con priorità minore) della peggiore presente prende il suo posto,
+   altrimenti viene scartata; ogni due coppie ricevute viene servita
+   la migliore. Con ENGINE_MINMAXHEAP il buffer è un MinMaxHeap, con
+   ENGINE_MINHEAP è formato da due MinHeap con le stesse chiavi, il
+   secondo dei quali con le priorità cambiate di segno. */
+static double bench_bounded(const double *prio, int n, int m, int cap, int engine)
+{
+    clock_t tstart = clock();
+    MinHeap *hmin = NULL, *hmax = NULL;
+    MinMaxHeap *mm = NULL;
+    int *free_key = (int*)malloc(cap * sizeof(*free_key));
+    int nfree = cap, i, key, full;
+
+    assert(free_key != NULL);
+    for (i=0; i<cap; i++) {
+        free_key[i] = i;
+    }
+    if (engine == ENGINE_MINMAXHEAP) {
+        mm = minmaxheap_create(cap);
+    } else {
+        hmin = minheap_create(cap);
+        hmax = minheap_create(cap);
+    }
+    for (i=0; i<m; i++) {
+        const double p = prio[i % n];
+        full = (nfree == 0);
+        if (full) {
+            if (engine == ENGINE_MINMAXHEAP) {
+                if (p < minmaxheap_max_prio(mm)) {
+                    free_key[nfree++] = minmaxheap_delete_max(mm);
+                }
+            } else if (p < -minheap_min_prio(hmax)) {
+                key = minheap_delete_min(hmax);
+                minheap_remove(hmin, key);
+                free_key[nfree++] = key;
+            }
+        }
+        if (nfree > 0) {
+            key = free_key[--nfree];
+            if (engine == ENGINE_MINMAXHEAP) {
+                minmaxheap_insert(mm, key, p);
+            } else {
+                minheap_insert(hmin, key, p);
+                minheap_insert(hmax, key, -p);
+            }
+        }
+        if (i % 2 == 1) {
+            if (engine == ENGINE_MINMAXHEAP) {
+                free_key[nfree++] = minmaxheap_delete_min(mm);
+            } else {
+                key = minheap_delete_min(hmin);
+                minheap_remove(hmax, key);
+                free_key[nfree++] = key;
+            }
+        }
+    }
+    if (engine == ENGINE_MINMAXHEAP) {
+        minmaxheap_destroy(mm);
+    } else {
+        minheap_destroy(hmin);
+        minheap_destroy(hmax);
+    }
+    free(free_key);
+    return elapsed_since(tstart);
+}
+
+/* Inserisce n elementi e li estrae tutti. Restituisce il tempo
+   impiegato. */
+static double bench_drain(MinHeap *h, const double *prio, int n)
+{
+    clock_t tstart = clock();
+    double last = -1.0;
+    int i;
+
+    for (i=0; i<n; i++) {
+        minheap_insert(h, i, prio[i]);
+    }
+    for (i=0; i<n; i++) {
+        const double p = minheap_min_prio(h);
+        assert(p >= last);
+        last = p;
+        minheap_delete_min(h);
+    }
+    return elapsed_since(tstart);
+}
+
+int main( int argc, char *argv[] )
+{
+#ifdef MINHEAP_BHEAP
+    const int arities[] = {2}; /* il B-heap è binario */
+#else
+    const int arities[] = {2, 4, 8, 16};
+#endif
+    const int nthreads[] = {0, 1, 2, 4};
+    int n = 1000000, i, a, t;
+    double *prio;
+    int *keys;
+
+    if (argc > 2) {
+        fprintf(stderr, "Usage: %s [n]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc == 2) {
+        n = atoi(argv[1]);
+    }
+    assert(n > 0);
+
+    prio = (double*)malloc(n * sizeof(*prio));
+    keys = (int*)malloc(n * sizeof(*keys));
+    assert(prio != NULL && keys != NULL);
+    srand(42);
+    for (i=0; i<n; i++) {
+        prio[i] = randunif();
+        keys[i] = i;
+    }
+
+#ifdef MINHEAP_SOA
+    printf("n=%d layout=SoA%s\n", n, LAYOUT_BHEAP);
+#else
+    printf("n=%d layout=AoS%s\n", n, LAYOUT_BHEAP);
+#endif
+    for (a=0; a<(int)(sizeof(arities)/sizeof(arities[0])); a++) {
+        MinHeap *h = minheap_create_arity(n, arities[a]);
+        const double t_hold = bench_hold(h, prio, n, 2*n);
+        const double t_drain = bench_drain(h, prio, n);
+        printf("arity=%2d  hold %f seconds  drain %f seconds\n",
+               arities[a], t_hold, t_drain);
+        minheap_destroy(h);
+    }
+
+    /* clock() misura il tempo di CPU complessivo di tutti i thread:
+       il tempo reale della versione parallela è minore */
+    printf("\nbuild (arity=%d, CPU time)\n", MINHEAP_ARITY);
+    for (t=0; t<(int)(sizeof(nthreads)/sizeof(nthreads[0])); t++) {
+        MinHeap *h = minheap_create(n);
+        const double elapsed = bench_build(h, keys, prio, n, nthreads[t]);
+        if (nthreads[t] == 0) {
+            printf("minheap_insert           %f seconds\n", elapsed);
+        } else {
+            printf("minheap_build, %d thread%s %f seconds\n",
+                   nthreads[t], (nthreads[t] > 1 ? "s" : " "), elapsed);
+        }
+        minheap_destroy(h);
+    }
+
+    printf("\nhold, %d operations (arity=%d)\n", 2*n, MINHEAP_ARITY);
+    for (t=1; t<=256; t*=16) {
+        MinHeap *h = minheap_create(n);
+        printf("B=%3d  %f seconds\n", t,
+               (t == 1 ? bench_hold(h, prio, n, 2*n) : bench_hold_batch(h, prio, n, 2*n, t)));
+        minheap_destroy(h);
+    }
+
+    printf("HashHeap %f seconds\n", bench_hold_hash(prio, n, 2*n));
+
+    printf("\ndecrease-key (%d per delete_min)\n", DECREASES_PER_DELETE);
+    printf("MinHeap   %f seconds\n", bench_decrease(prio, n, ENGINE_MINHEAP));
+    printf("PairHeap  %f seconds\n", bench_decrease(prio, n, ENGINE_PAIRHEAP));
+    printf("RadixHeap %f seconds\n", bench_decrease(prio, n, ENGINE_RADIXHEAP));
+
+    printf("\nhold, priorities in a window of width %d\n", WINDOW);
+    printf("MinHeap     %f seconds\n", bench_window(prio, n, 2*n, ENGINE_MINHEAP));
+    printf("BucketQueue %f seconds\n", bench_window(prio, n, 2*n, ENGINE_BUCKETQUEUE));
+    printf("CalQueue    %f seconds\n", bench_window(prio, n, 2*n, ENGINE_CALQUEUE));
+
+    printf("\nbounded buffer, capacity %d, %d pairs\n", n/16 + 1, 4*n);
+    printf("two MinHeaps %f seconds\n", bench_bounded(prio, n, 4*n, n/16 + 1, ENGINE_MINHEAP));
+    printf("MinMaxHeap   %f seconds\n", bench_bounded(prio, n, 4*n, n/16 + 1, ENGINE_MINMAXHEAP));
+
+    free(keys);
+    free(prio);
+    return EXIT_SUCCESS;
+}
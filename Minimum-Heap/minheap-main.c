@@ -27,9 +27,11 @@
 int main( int argc, char *argv[] )
 {
     char op;
-    int n, key;
+    int n, m, nthreads, i, key;
     double prio;
-    MinHeap *h;
+    int *keys;
+    double *prios;
+    MinHeap *h, *h2;
     FILE *filein = stdin;
 
     if (argc != 2) {
@@ -53,7 +55,7 @@ int main( int argc, char *argv[] )
     h = minheap_create(n);
 
     while (1 == fscanf(filein, " %c", &op)) {
-        //minheap_print(h);
+        /* minheap_print(h); */
         switch (op) {
         case '+': /* insert */
             fscanf(filein, "%d %lf", &key, &prio);
@@ -73,6 +75,73 @@ int main( int argc, char *argv[] )
             printf("minheap_change_prio(h, %d, %f)\n", key, prio);
             minheap_change_prio(h, key, prio);
             break;
+        case 'r': /* remove */
+            fscanf(filein, "%d", &key);
+            printf("minheap_remove(h, %d)\n", key);
+            minheap_remove(h, key);
+            break;
+        case 'k': /* contains */
+            fscanf(filein, "%d", &key);
+            printf("minheap_contains(h, %d) = %d\n", key, minheap_contains(h, key));
+            break;
+        case 'b': /* build */
+            fscanf(filein, "%d %d", &nthreads, &m);
+            keys = (int*)malloc((m > 0 ? m : 1) * sizeof(*keys));
+            prios = (double*)malloc((m > 0 ? m : 1) * sizeof(*prios));
+            if (keys == NULL || prios == NULL) {
+                fprintf(stderr, "Out of memory\n");
+                return EXIT_FAILURE;
+            }
+            for (i=0; i<m; i++) {
+                fscanf(filein, "%d %lf", &keys[i], &prios[i]);
+            }
+            printf("minheap_build_parallel(h, keys, prios, %d, %d)\n", m, nthreads);
+            minheap_build_parallel(h, keys, prios, m, nthreads);
+            free(keys);
+            free(prios);
+            break;
+        case 'i': /* insert batch */
+            fscanf(filein, "%d", &m);
+            keys = (int*)malloc((m > 0 ? m : 1) * sizeof(*keys));
+            prios = (double*)malloc((m > 0 ? m : 1) * sizeof(*prios));
+            if (keys == NULL || prios == NULL) {
+                fprintf(stderr, "Out of memory\n");
+                return EXIT_FAILURE;
+            }
+            for (i=0; i<m; i++) {
+                fscanf(filein, "%d %lf", &keys[i], &prios[i]);
+            }
+            printf("minheap_insert_batch(h, keys, prios, %d)\n", m);
+            minheap_insert_batch(h, keys, prios, m);
+            free(keys);
+            free(prios);
+            break;
+        case 'm': /* meld */
+            fscanf(filein, "%d", &m);
+            h2 = minheap_create(n);
+            for (i=0; i<m; i++) {
+                fscanf(filein, "%d %lf", &key, &prio);
+                minheap_insert(h2, key, prio);
+            }
+            printf("minheap_meld(h, h2), %d elements\n", m);
+            minheap_meld(h, h2);
+            minheap_destroy(h2);
+            break;
+        case 'd': /* delete k min */
+            fscanf(filein, "%d", &m);
+            keys = (int*)malloc((m > 0 ? m : 1) * sizeof(*keys));
+            if (keys == NULL) {
+                fprintf(stderr, "Out of memory\n");
+                return EXIT_FAILURE;
+            }
+            m = minheap_delete_min_k(h, m, keys, NULL);
+            printf("minheap_delete_min_k(h, %d) =", m);
+            for (i=0; i<m; i++) {
+                printf(" %d", keys[i]);
+            }
+            printf("\n");
+            free(keys);
+            break;
         case 's': /* get n of elements */
             printf("minheap_get_n(h) = %d\n", minheap_get_n(h));
             break;
@@ -166,6 +166,16 @@ Operazione                     Costo
 `minheap_insert()`             $O(\log n)$
 
 `minheap_change_prio()`        $O(n)$ oppure $O(\log n)$[^1]
+
+`minheap_contains()`           $O(1)$
+
+`minheap_remove()`             $O(\log n)$
+
+`minheap_build()`              $O(n)$
+
+`minheap_delete_min_k()`       $O(k \log n)$
+
+`minheap_meld()`               $O(n)$
 --------------------------------------------------------------
 
 [^1]: Per iniziare, realizzare `minheap_change_prio()` mediante una
@@ -196,14 +206,34 @@ _n_             Inizializza lo heap per contenere al più _n_ elementi;
 
 `c` _key prio_  Modifica la priorità associata alla chiave _key_
 
+`r` _key_       Rimuove la chiave _key_
+
+`k` _key_       Stampa 1 se la chiave _key_ è presente, 0 altrimenti
+
 `s`             Stampa il numero $n$ di elementi presenti nello heap
 
+`b` _t m k~1~ p~1~ ... k~m~ p~m~_
+                Sostituisce il contenuto dello heap con le _m_ coppie
+                <_k~i~, p~i~_> usando `minheap_build()` (se _t_ = 1)
+                oppure `minheap_build_parallel()` con _t_ thread
+
+`i` _m k~1~ p~1~ ... k~m~ p~m~_
+                Inserisce le _m_ coppie <_k~i~, p~i~_> con
+                `minheap_insert_batch()`
+
+`m` _m k~1~ p~1~ ... k~m~ p~m~_
+                Inserisce le _m_ coppie <_k~i~, p~i~_> in un secondo
+                heap, e lo unisce al primo con `minheap_meld()`
+
+`d` _k_         Cancella le _k_ coppie con priorità minima, e ne stampa
+                le chiavi
+
 `p`             Stampa il contenuto dello heap (per debug)
 ----------------------------------------------------------------------------
 
 Per compilare;
 
-        gcc -std=c90 -Wall -Wpedantic minheap.c minheap-main.c -o minheap-main
+        gcc -std=c90 -Wall -Wpedantic -pthread minheap.c minheap-main.c -o minheap-main
 
 Per eseguire in ambiente Linux/MacOSX:
 
@@ -267,11 +297,100 @@ $O(1)$ man mano che gli elementi in `heap[]` vengono scambiati tra
 loro durante le varie operazioni sullo heap. Ciò richiede un po' di
 attenzione, ma non è particolarmente problematico.
 
+### Heap d-ari
+
+La funzione `minheap_create_arity()` crea uno heap in cui ogni nodo ha
+$d$ figli, con $d$ potenza di due; i figli del nodo $i$ si trovano
+nelle posizioni $di + 1, \ldots, di + d$, e il padre in posizione
+$\lfloor (i-1)/d \rfloor$. L'altezza dello heap diventa $\log_d n$:
+`move_down()` esegue meno livelli, ciascuno dei quali confronta $d$
+figli contigui in memoria. Quando domina `minheap_delete_min()`,
+$d=4$ o $d=8$ sono in genere più veloci di $d=2$; il programma
+[minheap-bench.c](minheap-bench.c) consente di confrontarli.
+
+### Costruzione di uno heap
+
+Costruire uno heap con $n$ inserimenti richiede tempo $O(n \log n)$.
+La funzione `minheap_build()` copia invece tutte le coppie nell'array
+e poi applica `move_down()` ai nodi interni, dall'ultimo alla radice
+(algoritmo di Floyd): quando si elabora il nodo $i$, i sottoalberi
+dei suoi figli sono già degli heap. Poiché la maggior parte dei nodi
+si trova negli ultimi livelli, dove `move_down()` esegue pochi passi,
+il costo complessivo è $O(n)$.
+
+`minheap_build_parallel()` sfrutta il fatto che sottoalberi disgiunti
+possono essere elaborati in modo indipendente: si sceglie il primo
+livello con almeno `4*nthreads` nodi, e ogni thread copia i dati e
+applica l'algoritmo di Floyd ai sottoalberi radicati in un intervallo
+di nodi consecutivi di quel livello (i discendenti di nodi
+consecutivi occupano posizioni consecutive in ogni livello). Al
+termine, i pochi livelli superiori vengono sistemati dal thread
+chiamante. Per compilare è necessario il supporto ai thread POSIX
+(`-pthread`).
+
+### Operazioni su gruppi di elementi
+
+`minheap_insert_batch()` inserisce $m$ coppie con un'unica chiamata.
+Se $m$ è grande rispetto al numero di elementi presenti, le coppie
+vengono accodate all'array e si applica l'algoritmo di Floyd ai soli
+antenati dei nuovi nodi, che in ogni livello formano un intervallo di
+posizioni consecutive.
+
+`minheap_meld()` unisce due heap accodando gli elementi del secondo
+al primo, e poi procede come `minheap_insert_batch()`.
+
+`minheap_delete_min_k()` estrae le $k$ coppie con priorità minima.
+Queste formano un sottoalbero che contiene la radice, e possono
+essere individuate senza modificare lo heap usando un piccolo heap di
+_candidati_: inizialmente contiene solo la radice; ogni volta che si
+estrae il candidato di priorità minima, vi si inseriscono i suoi
+figli. Individuate le $k$ posizioni, le loro chiavi vengono rimosse
+tutte insieme: le posizioni rimaste libere vengono occupate dagli
+elementi presenti nelle ultime $k$ posizioni dell'array, e poi
+sistemate con `move_down()`.
+
+### Disposizione in memoria SoA
+
+Un `HeapElem` occupa 16 byte, di cui solo gli 8 della priorità sono
+letti da `min_child()`. Compilando con `-DMINHEAP_SOA` le priorità e
+le chiavi vengono memorizzate in due array separati `prio[]` e
+`key[]`: a parità di arity, `move_down()` legge la metà dei byte per
+livello (ad esempio gli 8 figli di un nodo con $d=8$ occupano
+un'unica linea di cache da 64 byte). Se il compilatore supporta SSE2,
+il minimo tra i figli di un nodo viene calcolato confrontando due
+priorità alla volta.
+
+### Disposizione in memoria B-heap
+
+Nello heap binario i nodi del cammino percorso da `move_down()` si
+trovano, dal decimo livello in poi, in pagine di memoria diverse:
+se lo heap risiede in un file mappato in memoria, o comunque in
+memoria virtuale, ogni livello può causare un _page fault_.
+Compilando con `-DMINHEAP_BHEAP` l'array viene organizzato come un
+_B-heap_ (P.-H. Kamp, _You're doing it wrong_, 2010): l'array è diviso
+in pagine di `MINHEAP_PAGE` byte, allineate, e ciascuna pagina
+contiene due sottoalberi binari, di altezza pari a circa $\log_2 B$
+dove $B$ è il numero di elementi per pagina. Dentro una pagina i
+figli di un nodo si trovano in posizioni calcolate come nello heap
+binario; i figli dei nodi dell'ultima riga di una pagina sono le
+radici dei sottoalberi di un'altra pagina. Un cammino dalla radice
+ad una foglia attraversa quindi $O(\log n / \log B)$ pagine.
+
+Le posizioni sono sempre occupate in ordine, da 0 a $n-1$, e il padre
+di ogni nodo ha indice minore del nodo stesso; gli algoritmi restano
+quindi invariati, tranne quelli che sfruttano il fatto che i nodi di
+uno stesso livello occupano posizioni consecutive: la costruzione
+(`minheap_build()`) elabora tutti i nodi anziché solo quelli fino al
+padre dell'ultimo, `minheap_build_parallel()` equivale a
+`minheap_build()`, e l'inserimento di gruppi di coppie sistema
+l'intero heap anziché solo gli antenati dei nuovi nodi.
+
 ## File
 
 - [minheap.c](minheap.c)
 - [minheap.h](minheap.h)
 - [minheap-main.c](minheap-main.c)
+- [minheap-bench.c](minheap-bench.c)
 - [minheap.in](minheap.in) ([output atteso](minheap.out))
 - [minheap1.in](minheap1.in)
 - [minheap2.in](minheap2.in)
@@ -281,8 +400,25 @@ attenzione, ma non è particolarmente problematico.
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <stdint.h>
+#include <limits.h>
+#include <pthread.h>
 #include "minheap.h"
 
+/* Accesso alla priorità e alla chiave dell'elemento in posizione `i`,
+   indipendentemente dalla disposizione in memoria scelta */
+#ifdef MINHEAP_SOA
+#define PRIO(h, i) ((h)->prio[i])
+#define KEY(h, i) ((h)->key[i])
+#else
+#define PRIO(h, i) ((h)->heap[i].prio)
+#define KEY(h, i) ((h)->heap[i].key)
+#endif
+
+#if defined(MINHEAP_SOA) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 void minheap_print(const MinHeap *h)
 {
     int i, j, width = 1;
@@ -290,44 +426,112 @@ void minheap_print(const MinHeap *h)
     assert(h != NULL);
 
     printf("\n** Contenuto dello heap:\n\n");
-    printf("n=%d size=%d\n", h->n, h->size);
+    printf("n=%d size=%d arity=%d\n", h->n, h->size, h->arity);
     printf("Contenuto dell'array heap[] (stampato a livelli):\n");
     i = 0;
     while (i < h->n) {
         j = 0;
         while (j<width && i < h->n) {
-            printf("h[%2d]=(%2d, %6.2f) ", i, h->heap[i].key, h->heap[i].prio);
+            printf("h[%2d]=(%2d, %6.2f) ", i, KEY(h, i), PRIO(h, i));
             i++;
             j++;
         }
         printf("\n");
-        width *= 2;
+        width *= h->arity;
     }
     printf("\n\n** Fine contenuto dello heap\n\n");
 }
 
 void minheap_clear( MinHeap *h )
 {
+    int i;
+
     assert(h != NULL);
+    for (i=0; i<h->n; i++) {
+        h->pos[KEY(h, i)] = -1;
+    }
     h->n = 0;
 }
 
 /* Costruisce un min-heap vuoto che può contenere al massimo
    `size` elementi */
 MinHeap *minheap_create(int size)
+{
+    return minheap_create_arity(size, MINHEAP_ARITY);
+}
+
+/* Dimensione (in byte) di una linea di cache */
+#define CACHE_LINE 64
+
+/* Allineamento dell'array heap[] (o prio[]); con MINHEAP_BHEAP
+   l'array viene spostato in avanti di HEAP_SKEW elementi rispetto
+   alla posizione che allinea l'elemento 1, per cui risulta allineato
+   l'elemento -1 */
+#ifdef MINHEAP_BHEAP
+#define HEAP_ALIGN MINHEAP_PAGE
+#define HEAP_SKEW 2
+#else
+#define HEAP_ALIGN CACHE_LINE
+#define HEAP_SKEW 0
+#endif
+
+/* Costruisce un min-heap d-ario vuoto. L'array heap[] (o prio[],
+   se MINHEAP_SOA è definito) viene posizionato in modo che
+   l'elemento 1 sia allineato all'inizio di una linea di cache: i
+   figli di ciascun nodo, che iniziano in posizione d*i + 1, occupano
+   allora il minimo numero possibile di linee (una sola se d = 4,
+   dato che sizeof(HeapElem) = 16, oppure, con MINHEAP_SOA, se d =
+   8). Con MINHEAP_BHEAP è invece allineato all'inizio di una pagina
+   l'elemento -1, cioè il nodo 0 nella numerazione del B-heap, che
+   inizia da 1 (si veda parent()). */
+MinHeap *minheap_create_arity(int size, int arity)
 {
     MinHeap *h = (MinHeap*)malloc(sizeof(*h));
+#ifdef MINHEAP_SOA
+    const int pad = HEAP_ALIGN / sizeof(double);
+#else
+    const int pad = HEAP_ALIGN / sizeof(HeapElem);
+#endif
+    uintptr_t addr;
+    int i;
+
     assert(h != NULL);
     assert(size > 0);
+    assert(arity >= 2 && arity <= 16 && (arity & (arity - 1)) == 0);
+#ifdef MINHEAP_BHEAP
+    assert(arity == 2);
+    for (h->page_shift = 0; (1 << h->page_shift) < pad; h->page_shift++)
+        ;
+#endif
 
     h->size = size;
-    h->heap = (HeapElem*)malloc(size * sizeof(*(h->heap)));
-    assert(h->heap != NULL);
-    h->pos = NULL; /* [TODO] qualora si decidesse di usare l'array
-                      `pos`, occorrerà allocarlo e inizializzarlo
-                      qui. Occorrerà poi liberare la memoria nella
-                      funzione `minheap_destroy()` */
-    minheap_clear(h);
+    h->arity = arity;
+    for (h->shift = 0; (1 << h->shift) < arity; h->shift++)
+        ;
+#ifdef MINHEAP_SOA
+    h->mem = (double*)malloc((size + pad + HEAP_SKEW) * sizeof(*(h->mem)));
+    h->key = (int*)malloc(size * sizeof(*(h->key)));
+    assert(h->mem != NULL && h->key != NULL);
+    addr = (uintptr_t)(h->mem + 1);
+    h->prio = h->mem + HEAP_SKEW;
+    if (addr % sizeof(double) == 0) {
+        h->prio += ((HEAP_ALIGN - addr % HEAP_ALIGN) % HEAP_ALIGN) / sizeof(double);
+    }
+#else
+    h->mem = (HeapElem*)malloc((size + pad + HEAP_SKEW) * sizeof(*(h->mem)));
+    assert(h->mem != NULL);
+    addr = (uintptr_t)(h->mem + 1);
+    h->heap = h->mem + HEAP_SKEW;
+    if (addr % sizeof(HeapElem) == 0) {
+        h->heap += ((HEAP_ALIGN - addr % HEAP_ALIGN) % HEAP_ALIGN) / sizeof(HeapElem);
+    }
+#endif
+    h->pos = (int*)malloc(size * sizeof(*(h->pos)));
+    assert(h->pos != NULL);
+    for (i=0; i<size; i++) {
+        h->pos[i] = -1;
+    }
+    h->n = 0;
     return h;
 }
 
@@ -336,7 +540,11 @@ void minheap_destroy( MinHeap *h )
     assert(h != NULL);
 
     h->n = h->size = 0;
-    free(h->heap);
+    free(h->mem);
+#ifdef MINHEAP_SOA
+    free(h->key);
+#endif
+    free(h->pos);
     free(h);
 }
 
@@ -363,62 +571,193 @@ static int valid(const MinHeap *h, int i)
     return ((i >= 0) && (i < h->n));
 }
 
-/* Funzione di supporto: scambia heap[i] con heap[j] */
+/* Funzione di supporto: scambia heap[i] con heap[j], aggiornando
+   di conseguenza pos[] */
 static void swap(MinHeap *h, int i, int j)
 {
+#ifdef MINHEAP_SOA
+    double tmp_prio;
+    int tmp_key;
+#else
     HeapElem tmp;
+#endif
 
     assert(h != NULL);
     assert(valid(h, i));
     assert(valid(h, j));
 
+#ifdef MINHEAP_SOA
+    tmp_prio = h->prio[i];
+    h->prio[i] = h->prio[j];
+    h->prio[j] = tmp_prio;
+    tmp_key = h->key[i];
+    h->key[i] = h->key[j];
+    h->key[j] = tmp_key;
+#else
     tmp = h->heap[i];
     h->heap[i] = h->heap[j];
     h->heap[j] = tmp;
-
+#endif
+    h->pos[KEY(h, i)] = i;
+    h->pos[KEY(h, j)] = j;
 }
 
-/* Funzione di supporto: restituisce l'indice del padre del nodo i */
+#ifdef MINHEAP_BHEAP
+/* Nel B-heap i nodi sono numerati a partire da 1: il nodo u si trova
+   in posizione u-1 dell'array, e la posizione "-1" è la prima di una
+   pagina. La pagina di u è u >> page_shift, la posizione di u nella
+   pagina (offset) u & mask.
+
+   - Nella pagina 0 la radice ha offset 1; nelle altre pagine gli
+     offset 0 e 1 sono le radici di due sottoalberi, ciascuno con un
+     solo figlio (offset 2 e 3).
+   - Il nodo di offset o >= 2 ha figli di offset 2o e 2o+1, se o è
+     nella metà inferiore della pagina.
+   - I due figli di ciascun nodo dell'ultima riga (offset o >= B/2)
+     sono le radici di una nuova pagina, la numero p*B/2 + (o - B/2) +
+     1 se p è la pagina del nodo. */
+
+/* Funzione di supporto: restituisce l'indice del padre del nodo i
+   (-1 se i è la radice) */
 static int parent(const MinHeap *h, int i)
 {
+    const int mask = (1 << h->page_shift) - 1;
+    const int u = i + 1, o = u & mask;
+    int v;
+
     assert(valid(h, i));
 
-    return (i+1)/2 - 1;
+    if (i == 0) {
+        return -1;
+    }
+    if (u <= mask || o > 3) {
+        v = (u & ~mask) | (o >> 1);
+    } else if (o < 2) {
+        v = (u >> h->page_shift) - 1;
+        v += v & ~(mask >> 1);
+        v |= (mask + 1) >> 1;
+    } else {
+        v = u - 2;
+    }
+    return v - 1;
 }
 
-/* Funzione di supporto: restituisce l'indice del figlio sinistro del
-   nodo `i`. Ritorna un indice non valido se `i` non ha figlio
-   sinistro. */
-static int lchild(const MinHeap *h, int i)
+/* Funzione di supporto: restituisce l'indice del primo figlio del
+   nodo `i`; se `i` ha due figli, il secondo lo segue. Ritorna un
+   indice non valido se `i` non ha figli. */
+static int first_child(const MinHeap *h, int i)
 {
+    const int mask = (1 << h->page_shift) - 1;
+    const int u = i + 1, o = u & mask;
+    int64_t c;
+
     assert(valid(h, i));
 
-    return 2*i + 1;
+    if (u > mask && o < 2) {
+        c = u + 2;
+    } else if (o & ((mask + 1) >> 1)) {
+        c = (int64_t)(u >> h->page_shift) * ((mask + 1) >> 1) + (o - ((mask + 1) >> 1)) + 1;
+        c <<= h->page_shift;
+    } else {
+        c = u + o;
+    }
+    return (c - 1 < INT_MAX - 2 ? (int)(c - 1) : INT_MAX - 2);
 }
 
-/* Funzione di supporto: restituisce l'indice del figlio destro del
-   nodo `i`. Ritorna un indice non valido se `i` non ha figlio
-   destro. */
-static int rchild(const MinHeap *h, int i)
+/* Funzione di supporto: restituisce l'indice successivo all'ultimo
+   figlio del nodo `i` */
+static int child_end(const MinHeap *h, int i)
+{
+    const int mask = (1 << h->page_shift) - 1;
+    const int u = i + 1;
+
+    return first_child(h, i) + ((u > mask && (u & mask) < 2) ? 1 : 2);
+}
+#else
+/* Funzione di supporto: restituisce l'indice del padre del nodo i
+   (-1 se i è la radice). In uno heap d-ario con d = 2^shift il padre
+   del nodo i è (i-1)/d. */
+static int parent(const MinHeap *h, int i)
 {
     assert(valid(h, i));
 
-    return 2*i + 2;
+    return (i == 0 ? -1 : (i-1) >> h->shift);
+}
+
+/* Funzione di supporto: restituisce l'indice del primo figlio del
+   nodo `i`; i figli di `i` occupano le posizioni consecutive
+   d*i + 1, ..., d*i + d. Ritorna un indice non valido se `i` non ha
+   figli. Il calcolo avviene a 64 bit, perché nelle foglie di uno
+   heap molto grande d*i + 1 può superare INT_MAX; il risultato viene
+   limitato in modo che child_end() non possa traboccare. */
+static int first_child(const MinHeap *h, int i)
+{
+    const int64_t c = ((int64_t)i << h->shift) + 1;
+
+    assert(valid(h, i));
+
+    return (c < INT_MAX - h->arity ? (int)c : INT_MAX - h->arity);
+}
+
+/* Funzione di supporto: restituisce l'indice successivo all'ultimo
+   figlio del nodo `i` */
+static int child_end(const MinHeap *h, int i)
+{
+    return first_child(h, i) + h->arity;
 }
+#endif
 
 /* Funzione di supporto: restituisce l'indice del figlio di `i` con
    priorità minima. Se `i` non ha figli, restituisce -1 */
 static int min_child(const MinHeap *h, int i)
 {
-    int lc, rc;
-    lc = lchild(h, i);
-    rc = rchild(h, i);
-    if (!valid(h, rc) && !valid(h, lc)) {
+    int c, end, best;
+
+    c = first_child(h, i);
+    if (!valid(h, c)) {
         return -1;
     }
-    else if (valid(h, rc) && valid(h, lc)) {
-        return h->heap[rc].prio < h->heap[lc].prio ? rc : lc;
+    end = child_end(h, i);
+    if (end > h->n) {
+        end = h->n;
+    }
+#if defined(MINHEAP_SOA) && defined(__SSE2__)
+    /* Con la disposizione SoA le priorità dei figli sono contigue:
+       se il nodo ha tutti i figli se ne calcola il minimo due alla
+       volta, e poi si individua con un confronto vettoriale il primo
+       figlio avente tale priorità. Se qualche priorità è NaN il
+       risultato di _mm_min_pd() dipende dall'ordine degli operandi, e
+       potrebbe non coincidere con alcun figlio: in tal caso si usa la
+       ricerca sequenziale, in modo da ottenere lo stesso risultato
+       della disposizione AoS. */
+    if (end - c == h->arity) {
+        const double *p = h->prio + c;
+        __m128d m = _mm_loadu_pd(p);
+        __m128d nan = _mm_cmpunord_pd(m, m);
+        int k;
+        for (k=2; k<h->arity; k+=2) {
+            const __m128d x = _mm_loadu_pd(p + k);
+            m = _mm_min_pd(m, x);
+            nan = _mm_or_pd(nan, _mm_cmpunord_pd(x, x));
+        }
+        if (_mm_movemask_pd(nan) == 0) {
+            m = _mm_min_pd(m, _mm_shuffle_pd(m, m, 1));
+            for (k=0; k<h->arity; k+=2) {
+                const int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(p + k), m));
+                if (mask != 0) {
+                    return c + k + ((mask & 1) ? 0 : 1);
+                }
+            }
+        }
+    }
+#endif
+    best = c;
+    for (c = c+1; c < end; c++) {
+        if (PRIO(h, c) < PRIO(h, best)) {
+            best = c;
+        }
     }
+    return best;
 }
 
 /* Funzione di supporto: scambia l'elemento in posizione `i` con il
@@ -430,7 +769,7 @@ static void move_up(MinHeap *h, int i)
     assert(valid(h, i));
 
     p = parent(h, i);
-    while ( valid(h, p) && (h->heap[i].prio < h->heap[p].prio) ) {
+    while ( valid(h, p) && (PRIO(h, i) < PRIO(h, p)) ) {
         swap(h, i, p);
         i = p;
         p = parent(h, i);
@@ -447,7 +786,7 @@ static void move_down(MinHeap *h, int i)
     assert(valid(h, i));
 
     c = min_child(h, i);
-    while (valid(h, c) && (h->heap[i].prio > h->heap[c].prio)) {
+    while (valid(h, c) && (PRIO(h, i) > PRIO(h, c))) {
         swap(h, i, c);
         i = c;
         c = min_child(h, i);
@@ -479,22 +818,50 @@ int minheap_get_n(const MinHeap *h)
     return h->n;
 }
 
+/* Restituisce la priorità minima */
+double minheap_min_prio(const MinHeap *h)
+{
+    assert( !minheap_is_empty(h) );
+
+    return PRIO(h, 0);
+}
+
 /* Restituisce la chiave associata alla priorità minima */
 int minheap_min(const MinHeap *h)
 {
     assert( !minheap_is_empty(h) );
 
-    return h->heap[0].key;
+    return KEY(h, 0);
 }
 
 
+/* Restituisce true (nonzero) se la chiave `key` è presente nello
+   heap; grazie all'array pos[] richiede tempo O(1). */
+int minheap_contains(const MinHeap *h, int key)
+{
+    assert(h != NULL);
+
+    return (key >= 0) && (key < h->size) && (h->pos[key] != -1);
+}
+
+/* Restituisce la priorità della chiave `key` */
+double minheap_get_prio(const MinHeap *h, int key)
+{
+    assert(minheap_contains(h, key));
+
+    return PRIO(h, h->pos[key]);
+}
+
 /* Inserisce una nuova coppia (key, prio) nello heap. */
 void minheap_insert(MinHeap *h, int key, double prio)
 {
     assert( !minheap_is_full(h) );
     assert((key >= 0) && (key < h->size));
-    h->heap[h->n].key = key;
-    h->heap[h->n].prio = prio;
+    assert( !minheap_contains(h, key) );
+
+    KEY(h, h->n) = key;
+    PRIO(h, h->n) = prio;
+    h->pos[key] = h->n;
     h->n++;
     move_up(h, h->n-1);
 }
@@ -503,31 +870,413 @@ void minheap_insert(MinHeap *h, int key, double prio)
    restituisce la chiave associata alla priorità minima. */
 int minheap_delete_min(MinHeap *h)
 {
-    assert( !minheap_is_empty(h) );
     int ret;
-    ret = h->heap->key;
-    h->heap->key = h->heap[h->n - 1].key;
-    h->heap->prio = h->heap[h->n - 1].prio;
+
+    assert( !minheap_is_empty(h) );
+
+    ret = KEY(h, 0);
+    swap(h, 0, h->n-1);
     h->n--;
-    move_down(h, 0);
+    h->pos[ret] = -1;
+    if (h->n > 0) {
+        move_down(h, 0);
+    }
     return ret;
 }
 
-
 /* Modifica la priorità associata alla chiave key. La nuova priorità
-   può essere maggiore, minore o uguale alla precedente. */
+   può essere maggiore, minore o uguale alla precedente. La posizione
+   di `key` nell'array heap[] si ottiene da pos[] in tempo O(1). */
 void minheap_change_prio(MinHeap *h, int key, double newprio)
 {
+    int i;
+    double oldprio;
+
     assert(h != NULL);
-    assert(key >= 0 && key < h->size);
+    assert(minheap_contains(h, key));
+
+    i = h->pos[key];
+    oldprio = PRIO(h, i);
+    PRIO(h, i) = newprio;
+    if (newprio < oldprio) {
+        move_up(h, i);
+    } else {
+        move_down(h, i);
+    }
+}
+
+/* Rimuove la coppia di chiave `key`: l'ultimo elemento dello heap
+   prende il suo posto, e viene spostato verso l'alto o verso il
+   basso fino alla posizione corretta. */
+void minheap_remove(MinHeap *h, int key)
+{
     int i;
-    i = 0;
-    HeapElem* tmp;
-    tmp = h->heap;
-    while (tmp[i].key != key) {
-        i++;
-    }
-    h->heap[i].prio = newprio;
-    move_up(h, i);
-    move_down(h, i);
+
+    assert(h != NULL);
+    assert(minheap_contains(h, key));
+
+    i = h->pos[key];
+    swap(h, i, h->n-1);
+    h->n--;
+    h->pos[key] = -1;
+    if (i < h->n) {
+        move_up(h, i);
+        move_down(h, i);
+    }
+}
+
+/* Funzione di supporto: copia le m coppie (keys[j], prios[j]) nelle
+   posizioni lo, ..., lo+m-1 dello heap, aggiornando pos[] */
+static void fill(MinHeap *h, const int *keys, const double *prios, int lo, int m)
+{
+    int j;
+
+    for (j=0; j<m; j++) {
+        assert((keys[j] >= 0) && (keys[j] < h->size));
+        assert(h->pos[keys[j]] == -1);
+        KEY(h, lo + j) = keys[j];
+        PRIO(h, lo + j) = prios[j];
+        h->pos[keys[j]] = lo + j;
+    }
+}
+
+/* Sostituisce il contenuto dello heap con le n coppie (keys[i],
+   prios[i]), usando l'algoritmo di Floyd: tempo O(n). */
+void minheap_build(MinHeap *h, const int *keys, const double *prios, int n)
+{
+    int i;
+
+    assert(h != NULL);
+    assert((n >= 0) && (n <= h->size));
+
+    minheap_clear(h);
+    fill(h, keys, prios, 0, n);
+    h->n = n;
+    if (n > 1) {
+#ifdef MINHEAP_BHEAP
+        /* nel B-heap anche i nodi che seguono il padre dell'ultimo
+           possono avere figli */
+        i = n-1;
+#else
+        i = parent(h, n-1);
+#endif
+        for ( ; i >= 0; i--) {
+            move_down(h, i);
+        }
+    }
+}
+
+/* Sotto questa soglia minheap_build_parallel() non crea thread */
+#define MINHEAP_PAR_MIN (1 << 16)
+
+/* Sottoalberi assegnati ad un thread da minheap_build_parallel(): le
+   radici sono i nodi lo, ..., hi-1, tutti dello stesso livello */
+typedef struct {
+    MinHeap *h;
+    const int *keys;
+    const double *prios;
+    int lo, hi;
+} BuildTask;
+
+static void *build_worker(void *arg)
+{
+    BuildTask *t = (BuildTask*)arg;
+    MinHeap *h = t->h;
+    const int last_parent = parent(h, h->n - 1);
+    int lo[32], hi[32]; /* nodi dei sottoalberi in ciascun livello */
+    int nlev = 0, l, i;
+
+    /* I discendenti dei nodi [a, b) di un livello sono i nodi
+       [d*a + 1, d*b + 1) del livello successivo */
+    lo[0] = t->lo;
+    hi[0] = t->hi;
+    while (1) {
+        fill(h, t->keys + lo[nlev], t->prios + lo[nlev], lo[nlev], hi[nlev] - lo[nlev]);
+        if (lo[nlev] > last_parent)
+            break;
+        if (hi[nlev] > last_parent + 1)
+            hi[nlev] = last_parent + 1;
+        lo[nlev+1] = first_child(h, lo[nlev]);
+        hi[nlev+1] = (((int64_t)hi[nlev] << h->shift) + 1 < h->n ?
+                      (hi[nlev] << h->shift) + 1 : h->n);
+        nlev++;
+    }
+    /* Algoritmo di Floyd, dal livello più profondo verso le radici;
+       le foglie dell'ultimo livello non richiedono alcuno spostamento */
+    for (l=nlev-1; l>=0; l--) {
+        for (i=hi[l]-1; i>=lo[l]; i--) {
+            move_down(h, i);
+        }
+    }
+    return NULL;
+}
+
+/* Come minheap_build(), ma usa `nthreads` thread */
+void minheap_build_parallel(MinHeap *h, const int *keys, const double *prios, int n, int nthreads)
+{
+    BuildTask *task;
+    pthread_t *tid;
+    int first = 0, width = 1, end, t, i;
+
+    assert(h != NULL);
+    assert((n >= 0) && (n <= h->size));
+    assert(nthreads >= 1);
+
+#ifdef MINHEAP_BHEAP
+    /* nel B-heap i discendenti di nodi consecutivi non occupano
+       posizioni consecutive */
+    nthreads = 1;
+#endif
+    if (nthreads == 1 || n < MINHEAP_PAR_MIN) {
+        minheap_build(h, keys, prios, n);
+        return;
+    }
+
+    minheap_clear(h);
+    h->n = n;
+    /* first è il primo nodo del livello delle radici dei sottoalberi,
+       width il numero di nodi di quel livello */
+    while (width < 4*nthreads && first + width < n) {
+        first += width;
+        width <<= h->shift;
+    }
+    end = (first + width < n ? first + width : n);
+    assert(first < end);
+
+    task = (BuildTask*)malloc(nthreads * sizeof(*task));
+    tid = (pthread_t*)malloc(nthreads * sizeof(*tid));
+    assert(task != NULL && tid != NULL);
+    for (t=0; t<nthreads; t++) {
+        task[t].h = h;
+        task[t].keys = keys;
+        task[t].prios = prios;
+        task[t].lo = first + (int)((long)(end - first) * t / nthreads);
+        task[t].hi = first + (int)((long)(end - first) * (t+1) / nthreads);
+        if (pthread_create(&tid[t], NULL, build_worker, &task[t]) != 0) {
+            /* se non è possibile creare il thread, i sottoalberi
+               vengono elaborati dal thread chiamante */
+            build_worker(&task[t]);
+            tid[t] = pthread_self();
+        }
+    }
+    /* I livelli superiori vengono copiati mentre i thread lavorano */
+    fill(h, keys, prios, 0, first);
+    for (t=0; t<nthreads; t++) {
+        if (!pthread_equal(tid[t], pthread_self())) {
+            pthread_join(tid[t], NULL);
+        }
+    }
+    for (i=first-1; i>=0; i--) {
+        move_down(h, i);
+    }
+    free(task);
+    free(tid);
+}
+
+/* Se il numero m di coppie inserite da minheap_insert_batch() è
+   almeno 1/MINHEAP_BATCH_RATIO degli elementi presenti, le coppie
+   vengono accodate e lo heap viene ricostruito; altrimenti si
+   applica move_up() ad una coppia alla volta. */
+#define MINHEAP_BATCH_RATIO 4
+
+/* Funzione di supporto: ripristina la proprietà di ordinamento dopo
+   che le coppie nelle posizioni lo, ..., n-1 sono state accodate ad
+   uno heap di lo elementi */
+static void fix_appended(MinHeap *h, int lo)
+{
+    const int m = h->n - lo;
+    int a, b, i;
+
+    if (m == 0) {
+        return;
+    }
+    if (MINHEAP_BATCH_RATIO * m < lo) {
+        for (i=lo; i<h->n; i++) {
+            move_up(h, i);
+        }
+        return;
+    }
+#ifdef MINHEAP_BHEAP
+    /* nel B-heap gli antenati delle nuove coppie non formano
+       intervalli: si applica l'algoritmo di Floyd a tutto lo heap */
+    for (i=h->n-1; i>=0; i--) {
+        move_down(h, i);
+    }
+    return;
+#endif
+    /* Algoritmo di Floyd ristretto agli antenati delle nuove coppie:
+       gli antenati dei nodi [lo, n-1] che si trovano allo stesso
+       "passo" verso la radice formano un intervallo [a, b]. Gli
+       intervalli vengono elaborati in ordine decrescente di indice,
+       per cui ogni nodo viene elaborato dopo i suoi figli. */
+    a = (lo > 0 ? parent(h, lo) : 0);
+    b = parent(h, h->n - 1);
+    while (1) {
+        for (i=b; i>=a; i--) {
+            move_down(h, i);
+        }
+        if (a == 0) {
+            break;
+        }
+        b = parent(h, b);
+        if (b >= a) {
+            b = a - 1;
+        }
+        a = parent(h, a);
+    }
+}
+
+/* Inserisce le m coppie (keys[i], prios[i]) */
+void minheap_insert_batch(MinHeap *h, const int *keys, const double *prios, int m)
+{
+    const int lo = h->n;
+
+    assert(h != NULL);
+    assert((m >= 0) && (m <= h->size - h->n));
+
+    fill(h, keys, prios, lo, m);
+    h->n += m;
+    fix_appended(h, lo);
+}
+
+/* Sposta tutte le coppie di h2 in h1 */
+void minheap_meld(MinHeap *h1, MinHeap *h2)
+{
+    const int lo = h1->n;
+    int i;
+
+    assert(h1 != NULL && h2 != NULL);
+    assert(h1 != h2);
+    assert(h2->n <= h1->size - h1->n);
+
+    for (i=0; i<h2->n; i++) {
+        const int key = KEY(h2, i);
+        assert(key < h1->size);
+        assert(h1->pos[key] == -1);
+        KEY(h1, lo + i) = key;
+        PRIO(h1, lo + i) = PRIO(h2, i);
+        h1->pos[key] = lo + i;
+    }
+    h1->n += h2->n;
+    minheap_clear(h2);
+    fix_appended(h1, lo);
+}
+
+/* Funzioni di supporto per lo heap dei candidati usato da
+   minheap_delete_min_k(): un piccolo heap binario che contiene
+   posizioni dello heap h, ordinate per priorità */
+static void cand_push(const MinHeap *h, int *cand, int *ncand, int i)
+{
+    int c = (*ncand)++, p;
+
+    while (c > 0 && PRIO(h, i) < PRIO(h, cand[p = (c-1)/2])) {
+        cand[c] = cand[p];
+        c = p;
+    }
+    cand[c] = i;
+}
+
+static int cand_pop(const MinHeap *h, int *cand, int *ncand)
+{
+    const int ret = cand[0], last = cand[--(*ncand)];
+    int c = 0, s;
+
+    while ((s = 2*c + 1) < *ncand) {
+        if (s+1 < *ncand && PRIO(h, cand[s+1]) < PRIO(h, cand[s])) {
+            s++;
+        }
+        if (PRIO(h, cand[s]) >= PRIO(h, last)) {
+            break;
+        }
+        cand[c] = cand[s];
+        c = s;
+    }
+    cand[c] = last;
+    return ret;
+}
+
+static int compare_int_desc(const void *p1, const void *p2)
+{
+    const int a = *(const int*)p1, b = *(const int*)p2;
+    return (a < b) - (a > b);
+}
+
+/* Rimuove le k coppie con priorità minima */
+int minheap_delete_min_k(MinHeap *h, int k, int *keys, double *prios)
+{
+    int *sel, *cand;
+    int ncand = 0, nholes = 0, newn, i, j, c, end;
+    int64_t maxcand;
+
+    assert(h != NULL);
+    assert(k >= 0);
+
+    if (k > h->n) {
+        k = h->n;
+    }
+    if (k == 0) {
+        return 0;
+    }
+    /* i candidati sono nodi distinti dello heap, per cui non sono
+       mai più di n; k * arity + 1 può invece superare INT_MAX */
+    maxcand = (int64_t)k * h->arity + 1;
+    if (maxcand > h->n) {
+        maxcand = h->n;
+    }
+    sel = (int*)malloc(k * sizeof(*sel));
+    cand = (int*)malloc((size_t)maxcand * sizeof(*cand));
+    assert(sel != NULL && cand != NULL);
+
+    /* Selezione: le k priorità minime si trovano in un sottoalbero
+       che contiene la radice; ogni volta che un nodo viene estratto
+       dallo heap dei candidati, vi si aggiungono i suoi figli */
+    cand_push(h, cand, &ncand, 0);
+    for (j=0; j<k; j++) {
+        i = sel[j] = cand_pop(h, cand, &ncand);
+        keys[j] = KEY(h, i);
+        if (prios != NULL) {
+            prios[j] = PRIO(h, i);
+        }
+        h->pos[KEY(h, i)] = -1;
+        c = first_child(h, i);
+        end = child_end(h, i);
+        if (end > h->n) {
+            end = h->n;
+        }
+        for ( ; c<end; c++) {
+            cand_push(h, cand, &ncand, c);
+        }
+    }
+
+    /* Rimozione: le posizioni selezionate minori di n-k ("buchi")
+       vengono occupate dagli elementi non selezionati che si trovano
+       nelle ultime k posizioni. L'insieme dei buchi contiene il padre
+       di ogni suo elemento, per cui basta applicare move_down() ai
+       buchi in ordine decrescente di indice (come nell'algoritmo di
+       Floyd). */
+    newn = h->n - k;
+    for (j=0; j<k; j++) {
+        if (sel[j] < newn) {
+            sel[nholes++] = sel[j];
+        }
+    }
+    j = 0;
+    for (i=newn; i<h->n; i++) {
+        if (h->pos[KEY(h, i)] != -1) {
+            KEY(h, sel[j]) = KEY(h, i);
+            PRIO(h, sel[j]) = PRIO(h, i);
+            h->pos[KEY(h, i)] = sel[j];
+            j++;
+        }
+    }
+    assert(j == nholes);
+    h->n = newn;
+    qsort(sel, nholes, sizeof(*sel), compare_int_desc);
+    for (j=0; j<nholes; j++) {
+        move_down(h, sel[j]);
+    }
+
+    free(sel);
+    free(cand);
+    return k;
 }
@@ -27,11 +27,46 @@ typedef struct {
     double prio;
 } HeapElem;
 
+/* Numero di figli di ciascun nodo negli heap creati con
+   `minheap_create()`; può essere modificato in fase di compilazione,
+   ad esempio con -DMINHEAP_ARITY=4 */
+#ifndef MINHEAP_ARITY
+#define MINHEAP_ARITY 2
+#endif
+
+/* Se MINHEAP_SOA è definito (ad esempio con -DMINHEAP_SOA), le
+   priorità e le chiavi sono memorizzate in due array separati prio[]
+   e key[] anziché in un unico array heap[] di HeapElem ("structure of
+   arrays" invece di "array of structures"): `move_down()` legge
+   soltanto le priorità dei figli, che occupano 8 byte ciascuna
+   anziché 16. Le funzioni dell'interfaccia sono le stesse. */
+/* Se MINHEAP_BHEAP è definito, l'array heap[] (o prio[]) è
+   organizzato come un B-heap: ogni pagina di MINHEAP_PAGE byte
+   contiene un sottoalbero, per cui `move_down()` e `move_up()`
+   accedono a O(log n / log B) pagine anziché ad una pagina per
+   livello, dove B è il numero di elementi per pagina. Gli heap creati
+   in questo modo sono binari (arity = 2). Si veda minheap.c. */
+#ifndef MINHEAP_PAGE
+#define MINHEAP_PAGE 4096
+#endif
+
 typedef struct {
+#ifdef MINHEAP_SOA
+    double *prio; /* prio[i] è la priorità dell'elemento in posizione i */
+    int *key; /* key[i] è la chiave dell'elemento in posizione i */
+    double *mem; /* blocco allocato con malloc() che contiene prio[] */
+#else
     HeapElem *heap;
-    int *pos; /* TODO: non inizializzato! Usare solo dopo una implementazione funzionante di minheap_change_prio() in cui la chiave da modificare si trova con una normale ricerca lineare sull'array heap[] */
+    HeapElem *mem; /* blocco allocato con malloc() che contiene heap[] */
+#endif
+    int *pos; /* pos[k] è l'indice in heap[] della coppia di chiave k, oppure -1 se k non è presente */
     int n; /* quante coppie (chiave, prio) sono effettivamente presenti nello heap */
     int size; /* massimo numero di coppie (chiave, prio) che possono essere contenuti nello heap */
+    int arity; /* numero di figli di ciascun nodo */
+    int shift; /* arity == 1 << shift */
+#ifdef MINHEAP_BHEAP
+    int page_shift; /* ogni pagina contiene 1 << page_shift elementi */
+#endif
 } MinHeap;
 
 /* Crea uno heap vuoto in grado di contenere al più `size` coppie
@@ -42,6 +77,15 @@ typedef struct {
    Precondizione: size > 0 */
 MinHeap *minheap_create(int size);
 
+/* Come `minheap_create()`, ma crea uno heap d-ario in cui ogni nodo
+   ha `arity` figli anziché due. Con arity = 4 o 8 lo heap ha meno
+   livelli, per cui `minheap_delete_min()` esegue meno scambi, e i
+   figli di un nodo sono contigui in memoria.
+
+   Precondizione: arity è una potenza di due compresa tra 2 e 16
+   (uguale a 2 se MINHEAP_BHEAP è definito) */
+MinHeap *minheap_create_arity(int size, int arity);
+
 /* Svuota lo heap */
 void minheap_clear(MinHeap *h);
 
@@ -61,6 +105,14 @@ int minheap_get_n(const MinHeap *h);
    lo heap */
 int minheap_min(const MinHeap *h);
 
+/* Restituisce la minima priorità; non modifica lo heap */
+double minheap_min_prio(const MinHeap *h);
+
+/* Restituisce la priorità associata alla chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+double minheap_get_prio(const MinHeap *h, int key);
+
 /* Inserisce una nuova chiave `key` con priorità `prio`.
 
    Precondizioni:
@@ -80,6 +132,60 @@ int minheap_delete_min(MinHeap *h);
    Precondizione: la chiave `key` deve essere presente nello heap. */
 void minheap_change_prio(MinHeap *h, int key, double new_prio);
 
+/* Restituisce 1 se e solo se la chiave `key` è presente nello heap */
+int minheap_contains(const MinHeap *h, int key);
+
+/* Rimuove dallo heap la coppia (chiave, prio) di chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+void minheap_remove(MinHeap *h, int key);
+
+/* Sostituisce il contenuto dello heap con le `n` coppie (keys[i],
+   prios[i]), i = 0, ..., n-1, in tempo O(n); è più efficiente di n
+   chiamate a `minheap_insert()`.
+
+   Precondizioni:
+   - n <= size;
+   - le chiavi keys[0..n-1] devono essere valide e distinte. */
+void minheap_build(MinHeap *h, const int *keys, const double *prios, int n);
+
+/* Come `minheap_build()`, ma usa `nthreads` thread POSIX; conviene
+   solo per heap molto grandi (per n piccolo equivale a
+   `minheap_build()`).
+
+   Precondizione: nthreads >= 1 */
+void minheap_build_parallel(MinHeap *h, const int *keys, const double *prios, int n, int nthreads);
+
+/* Inserisce le `m` coppie (keys[i], prios[i]), i = 0, ..., m-1. Se
+   m è grande rispetto al numero di elementi presenti, le coppie
+   vengono accodate e lo heap viene ricostruito, altrimenti vengono
+   inserite una alla volta.
+
+   Precondizioni:
+   - nello heap devono esserci almeno `m` posizioni libere;
+   - le chiavi keys[0..m-1] devono essere valide, distinte e non
+     presenti nello heap. */
+void minheap_insert_batch(MinHeap *h, const int *keys, const double *prios, int m);
+
+/* Sposta tutte le coppie di `h2` in `h1`, che deve avere spazio
+   sufficiente; `h2` rimane vuoto. Le coppie vengono accodate e lo
+   heap viene sistemato come in `minheap_insert_batch()`: tempo O(n)
+   nel caso peggiore. Per unire due heap in tempo O(1) si veda
+   pairheap.h.
+
+   Precondizione: le chiavi di `h2` devono essere valide per `h1` e
+   non presenti in `h1` */
+void minheap_meld(MinHeap *h1, MinHeap *h2);
+
+/* Rimuove dallo heap le `k` coppie con priorità minima (tutte, se
+   lo heap contiene meno di `k` elementi), e ne scrive le chiavi in
+   keys[] e, se `prios` non è NULL, le priorità in prios[], in ordine
+   non decrescente di priorità. Restituisce il numero di coppie
+   rimosse.
+
+   Precondizione: k >= 0 */
+int minheap_delete_min_k(MinHeap *h, int k, int *keys, double *prios);
+
 /* Stampa il contenuto dello heap */
 void minheap_print(const MinHeap *h);
 
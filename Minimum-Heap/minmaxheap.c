@@ -0,0 +1,406 @@
+/****************************************************************************
+ *
+ * minmaxheap.c -- Min-Max Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Min-Max Heap
+% Ultimo aggiornamento: 2026-10-19
+
+Un _min-max heap_ (Atkinson, Sack, Santoro, Strothotte, 1986) è una
+coda di priorità "a due estremità": consente di estrarre sia la
+coppia di priorità minima che quella di priorità massima in tempo
+$O(\log n)$. È utile, ad esempio, per mantenere un buffer di capienza
+limitata che serve la coppia migliore e, quando è pieno, scarta la
+peggiore; senza questa struttura servono due heap, uno dei quali con
+le priorità cambiate di segno, da mantenere allineati.
+
+La struttura è un albero binario completo memorizzato in un array,
+come lo heap binario di [minheap.c](minheap.c), ma i livelli sono
+alternativamente _di minimo_ (i livelli pari, a partire dalla radice)
+e _di massimo_ (i livelli dispari):
+
+- la priorità di un nodo in un livello di minimo è minore o uguale a
+  quella di tutti i suoi discendenti;
+
+- la priorità di un nodo in un livello di massimo è maggiore o
+  uguale a quella di tutti i suoi discendenti.
+
+Quindi il minimo è la radice, e il massimo è uno dei suoi (al più
+due) figli.
+
+- L'inserimento aggiunge il nuovo nodo in fondo all'array e lo
+  confronta con il padre, che si trova in un livello di tipo opposto:
+  se necessario vi si scambia; poi il nodo risale di due livelli alla
+  volta (con il nonno), scambiandosi finché è necessario.
+
+- Per rimuovere il nodo in posizione $i$, l'ultimo nodo ne prende il
+  posto e scende di due livelli alla volta: se $i$ è in un livello
+  di minimo, il nodo si scambia con il minimo tra figli e nipoti; se
+  si è scambiato con un nipote, e la sua priorità supera quella del
+  nuovo padre (che è in un livello di massimo), si scambia anche con
+  il padre. Il caso dei livelli di massimo è simmetrico.
+
+- La modifica della priorità di un nodo lo fa prima scendere, come
+  nella rimozione, e poi risalire, come nell'inserimento, a partire
+  dalla posizione raggiunta.
+
+Come in `MinHeap`, l'array `pos[]` consente di trovare la posizione
+di una chiave in tempo $O(1)$.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic minmaxheap.c minmaxheap-main.c -o minmaxheap-main
+
+Per eseguire:
+
+        ./minmaxheap-main inputfile
+
+dove `inputfile` contiene i comandi `+`, `-`, `?`, `c`, `r`, `k`, `s`
+e `p` di [minheap-main.c](minheap-main.c), e inoltre:
+
+Comando     Significato
+----------  -----------------------------------
+`>`         `minmaxheap_delete_max()`
+`^`         `minmaxheap_max()`
+
+## File
+
+- [minmaxheap.c](minmaxheap.c)
+- [minmaxheap.h](minmaxheap.h)
+- [minmaxheap-main.c](minmaxheap-main.c)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "minmaxheap.h"
+
+void minmaxheap_print(const MinMaxHeap *h)
+{
+    int i, j, width = 1;
+
+    assert(h != NULL);
+
+    printf("\n** Contenuto dello heap:\n\n");
+    printf("n=%d size=%d\n", h->n, h->size);
+    printf("Contenuto dell'array heap[] (stampato a livelli):\n");
+    i = 0;
+    while (i < h->n) {
+        j = 0;
+        while (j<width && i < h->n) {
+            printf("h[%2d]=(%2d, %6.2f) ", i, h->heap[i].key, h->heap[i].prio);
+            i++;
+            j++;
+        }
+        printf("\n");
+        width *= 2;
+    }
+    printf("\n\n** Fine contenuto dello heap\n\n");
+}
+
+MinMaxHeap *minmaxheap_create(int size)
+{
+    MinMaxHeap *h = (MinMaxHeap*)malloc(sizeof(*h));
+    int i;
+
+    assert(h != NULL);
+    assert(size > 0);
+
+    h->size = size;
+    h->heap = (MinMaxElem*)malloc(size * sizeof(*(h->heap)));
+    h->pos = (int*)malloc(size * sizeof(*(h->pos)));
+    assert(h->heap != NULL && h->pos != NULL);
+    for (i=0; i<size; i++) {
+        h->pos[i] = -1;
+    }
+    h->n = 0;
+    return h;
+}
+
+void minmaxheap_clear(MinMaxHeap *h)
+{
+    int i;
+
+    assert(h != NULL);
+
+    for (i=0; i<h->n; i++) {
+        h->pos[h->heap[i].key] = -1;
+    }
+    h->n = 0;
+}
+
+void minmaxheap_destroy(MinMaxHeap *h)
+{
+    assert(h != NULL);
+
+    free(h->heap);
+    free(h->pos);
+    free(h);
+}
+
+/* Funzione di supporto: restituisce 1 sse l'indice `i` appartiene
+   all'intervallo degli indici validi degli elementi validi nell'array
+   che rappresenta lo heap. */
+static int valid(const MinMaxHeap *h, int i)
+{
+    assert(h != NULL);
+
+    return ((i >= 0) && (i < h->n));
+}
+
+/* Funzione di supporto: scambia heap[i] con heap[j], aggiornando
+   di conseguenza pos[] */
+static void swap(MinMaxHeap *h, int i, int j)
+{
+    MinMaxElem tmp;
+
+    assert(valid(h, i));
+    assert(valid(h, j));
+
+    tmp = h->heap[i];
+    h->heap[i] = h->heap[j];
+    h->heap[j] = tmp;
+    h->pos[h->heap[i].key] = i;
+    h->pos[h->heap[j].key] = j;
+}
+
+/* Funzione di supporto: restituisce 1 se il nodo `i` si trova in un
+   livello di minimo, cioè se il livello floor(log2(i+1)) è pari */
+static int is_min_level(int i)
+{
+    int level = 0;
+
+    for (i = i+1; i > 1; i >>= 1) {
+        level++;
+    }
+    return (level % 2 == 0);
+}
+
+/* Funzione di supporto: restituisce 1 se, in un livello di minimo
+   (is_min != 0), il nodo `i` deve stare sopra al nodo `j`, cioè se
+   prio(i) < prio(j); nei livelli di massimo il confronto è
+   invertito */
+static int before(const MinMaxHeap *h, int i, int j, int is_min)
+{
+    return (is_min ? h->heap[i].prio < h->heap[j].prio : h->heap[i].prio > h->heap[j].prio);
+}
+
+/* Funzione di supporto: fa risalire il nodo `i` di due livelli alla
+   volta, tra i livelli del suo tipo */
+static void move_up_grand(MinMaxHeap *h, int i, int is_min)
+{
+    while (i > 2) {
+        const int g = ((i-1)/2 - 1)/2;
+        if (!before(h, i, g, is_min))
+            break;
+        swap(h, i, g);
+        i = g;
+    }
+}
+
+/* Funzione di supporto: sistema il nodo `i` rispetto ai suoi
+   antenati */
+static void move_up(MinMaxHeap *h, int i)
+{
+    const int is_min = is_min_level(i);
+    int p;
+
+    assert(valid(h, i));
+
+    if (i == 0)
+        return;
+    p = (i-1)/2;
+    if (before(h, p, i, is_min)) {
+        /* il nodo appartiene ai livelli di tipo opposto */
+        swap(h, i, p);
+        move_up_grand(h, p, !is_min);
+    } else {
+        move_up_grand(h, i, is_min);
+    }
+}
+
+/* Funzione di supporto: sistema il nodo `i` rispetto ai suoi
+   discendenti, facendolo scendere di due livelli alla volta */
+static void move_down(MinMaxHeap *h, int i)
+{
+    const int is_min = is_min_level(i);
+    int m, c, g, p;
+
+    assert(valid(h, i));
+
+    while (1) {
+        /* m è il "migliore" tra figli e nipoti di i */
+        c = 2*i + 1;
+        if (!valid(h, c))
+            return;
+        m = c;
+        if (valid(h, c+1) && before(h, c+1, m, is_min))
+            m = c+1;
+        for (g = 2*c + 1; g <= 2*c + 4 && valid(h, g); g++) {
+            if (before(h, g, m, is_min))
+                m = g;
+        }
+        if (!before(h, m, i, is_min))
+            return;
+        swap(h, i, m);
+        if (m <= c+1) {
+            /* m è un figlio, quindi non ha discendenti tra cui il
+               nodo debba ancora scendere */
+            return;
+        }
+        p = (m-1)/2;
+        if (before(h, p, m, is_min)) {
+            swap(h, m, p);
+        }
+        i = m;
+    }
+}
+
+int minmaxheap_is_empty(const MinMaxHeap *h)
+{
+    assert(h != NULL);
+
+    return (h->n == 0);
+}
+
+int minmaxheap_is_full(const MinMaxHeap *h)
+{
+    assert(h != NULL);
+
+    return (h->n == h->size);
+}
+
+int minmaxheap_get_n(const MinMaxHeap *h)
+{
+    assert(h != NULL);
+
+    return h->n;
+}
+
+/* Funzione di supporto: restituisce la posizione della coppia di
+   priorità massima */
+static int max_index(const MinMaxHeap *h)
+{
+    assert( !minmaxheap_is_empty(h) );
+
+    if (h->n == 1)
+        return 0;
+    if (h->n == 2 || h->heap[1].prio >= h->heap[2].prio)
+        return 1;
+    return 2;
+}
+
+int minmaxheap_min(const MinMaxHeap *h)
+{
+    assert( !minmaxheap_is_empty(h) );
+
+    return h->heap[0].key;
+}
+
+double minmaxheap_min_prio(const MinMaxHeap *h)
+{
+    assert( !minmaxheap_is_empty(h) );
+
+    return h->heap[0].prio;
+}
+
+int minmaxheap_max(const MinMaxHeap *h)
+{
+    return h->heap[max_index(h)].key;
+}
+
+double minmaxheap_max_prio(const MinMaxHeap *h)
+{
+    return h->heap[max_index(h)].prio;
+}
+
+int minmaxheap_contains(const MinMaxHeap *h, int key)
+{
+    assert(h != NULL);
+
+    return (key >= 0) && (key < h->size) && (h->pos[key] != -1);
+}
+
+double minmaxheap_get_prio(const MinMaxHeap *h, int key)
+{
+    assert(minmaxheap_contains(h, key));
+
+    return h->heap[h->pos[key]].prio;
+}
+
+void minmaxheap_insert(MinMaxHeap *h, int key, double prio)
+{
+    assert( !minmaxheap_is_full(h) );
+    assert((key >= 0) && (key < h->size));
+    assert( !minmaxheap_contains(h, key) );
+
+    h->heap[h->n].key = key;
+    h->heap[h->n].prio = prio;
+    h->pos[key] = h->n;
+    h->n++;
+    move_up(h, h->n-1);
+}
+
+/* Funzione di supporto: rimuove la coppia in posizione `i`, che
+   viene sostituita dall'ultima; questa scende fino alla posizione
+   corretta tra i discendenti di i e poi, se necessario, risale */
+static int remove_at(MinMaxHeap *h, int i)
+{
+    const int key = h->heap[i].key;
+
+    swap(h, i, h->n-1);
+    h->n--;
+    h->pos[key] = -1;
+    if (i < h->n) {
+        const int moved = h->heap[i].key;
+        move_down(h, i);
+        move_up(h, h->pos[moved]);
+    }
+    return key;
+}
+
+int minmaxheap_delete_min(MinMaxHeap *h)
+{
+    assert( !minmaxheap_is_empty(h) );
+
+    return remove_at(h, 0);
+}
+
+int minmaxheap_delete_max(MinMaxHeap *h)
+{
+    return remove_at(h, max_index(h));
+}
+
+void minmaxheap_change_prio(MinMaxHeap *h, int key, double new_prio)
+{
+    assert(minmaxheap_contains(h, key));
+
+    h->heap[h->pos[key]].prio = new_prio;
+    move_down(h, h->pos[key]);
+    move_up(h, h->pos[key]);
+}
+
+void minmaxheap_remove(MinMaxHeap *h, int key)
+{
+    assert(minmaxheap_contains(h, key));
+
+    remove_at(h, h->pos[key]);
+}
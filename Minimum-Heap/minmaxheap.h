@@ -0,0 +1,123 @@
+/****************************************************************************
+ *
+ * minmaxheap.h -- Interfaccia Min-Max Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef MINMAXHEAP_H
+#define MINMAXHEAP_H
+
+typedef struct {
+    int key;
+    double prio;
+} MinMaxElem;
+
+typedef struct {
+    MinMaxElem *heap; /* heap[0..n-1] contiene le coppie (chiave, prio) */
+    int *pos; /* pos[k] è l'indice in heap[] della coppia di chiave k, oppure -1 se k non è presente */
+    int n; /* quante coppie (chiave, prio) sono effettivamente presenti nello heap */
+    int size; /* massimo numero di coppie (chiave, prio) che possono essere contenuti nello heap */
+} MinMaxHeap;
+
+/* Crea uno heap vuoto in grado di contenere al più `size` coppie
+   (chiave, priorità); le chiavi possono essere esclusivamente gli
+   interi 0 .. `size` - 1; ogni chiave può essere presente nello heap
+   al più una volta.
+
+   Precondizione: size > 0 */
+MinMaxHeap *minmaxheap_create(int size);
+
+/* Svuota lo heap */
+void minmaxheap_clear(MinMaxHeap *h);
+
+/* Dealloca la memoria occupata dallo heap h e dal suo contenuto */
+void minmaxheap_destroy(MinMaxHeap *h);
+
+/* Restituisce 1 se e solo se lo heap è vuoto */
+int minmaxheap_is_empty(const MinMaxHeap *h);
+
+/* Restituisce 1 se e solo se lo heap è pieno */
+int minmaxheap_is_full(const MinMaxHeap *h);
+
+/* Ritorna il numero di elementi effettivamente presenti nello heap */
+int minmaxheap_get_n(const MinMaxHeap *h);
+
+/* Restituisce la chiave associata alla minima priorità; non modifica
+   lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int minmaxheap_min(const MinMaxHeap *h);
+
+/* Restituisce la minima priorità; non modifica lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+double minmaxheap_min_prio(const MinMaxHeap *h);
+
+/* Restituisce la chiave associata alla massima priorità; non modifica
+   lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int minmaxheap_max(const MinMaxHeap *h);
+
+/* Restituisce la massima priorità; non modifica lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+double minmaxheap_max_prio(const MinMaxHeap *h);
+
+/* Restituisce la priorità associata alla chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+double minmaxheap_get_prio(const MinMaxHeap *h, int key);
+
+/* Inserisce una nuova chiave `key` con priorità `prio`.
+
+   Precondizioni:
+   - `key` deve essere una chiave valida;
+   - `key` non deve essere già presente nello heap;
+   - Lo heap non deve essere pieno. */
+void minmaxheap_insert(MinMaxHeap *h, int key, double prio);
+
+/* Rimuove dallo heap la coppia (chiave, prio) con priorità minima, e
+   restituisce la chiave di tale coppia.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int minmaxheap_delete_min(MinMaxHeap *h);
+
+/* Rimuove dallo heap la coppia (chiave, prio) con priorità massima, e
+   restituisce la chiave di tale coppia.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int minmaxheap_delete_max(MinMaxHeap *h);
+
+/* Modifica la priorità associata alla chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+void minmaxheap_change_prio(MinMaxHeap *h, int key, double new_prio);
+
+/* Restituisce 1 se e solo se la chiave `key` è presente nello heap */
+int minmaxheap_contains(const MinMaxHeap *h, int key);
+
+/* Rimuove dallo heap la coppia (chiave, prio) di chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+void minmaxheap_remove(MinMaxHeap *h, int key);
+
+/* Stampa il contenuto dello heap */
+void minmaxheap_print(const MinMaxHeap *h);
+
+#endif
@@ -0,0 +1,254 @@
+/****************************************************************************
+ *
+ * multiqueue-bench.c -- Misura delle prestazioni di MultiQueue
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Confronta il throughput di una MultiQueue (multiqueue.c) con quello
+   di un singolo MinHeap protetto da un mutex, al variare del numero
+   di thread, nel modello "hold": ogni thread estrae ripetutamente una
+   coppia e la reinserisce con una priorità maggiore. I tempi sono
+   tempi reali (non di CPU). Al termine verifica che la coda contenga
+   ancora tutte le chiavi, ciascuna una sola volta.
+
+   Misura inoltre, con un solo thread, il rango medio delle coppie
+   estratte dalla MultiQueue, cioè quante coppie presenti nella coda
+   hanno priorità strettamente minore (0 per una coda esatta).
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread minheap.c multiqueue.c multiqueue-bench.c -o multiqueue-bench
+
+   Per eseguire:
+
+        ./multiqueue-bench [n [m [maxthreads]]]
+
+   dove `n` (default 1000000) è il numero di coppie nella coda, `m`
+   (default 4000000) il numero complessivo di operazioni di
+   estrazione e reinserimento, e `maxthreads` (default 8) il massimo
+   numero di thread. */
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include <pthread.h>
+#include "minheap.h"
+#include "multiqueue.h"
+
+#define MAX_THREADS 64
+
+/* Restituisce un valore reale pseudocasuale in [0, 1) (xorshift) */
+static double randunif(uint32_t *s)
+{
+    uint32_t x = *s;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *s = x;
+    return x / 4294967296.0;
+}
+
+static double wall_time( void )
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1.0e9;
+}
+
+/* Lavoro assegnato ad un thread: esattamente uno tra `mq` e `h` è
+   diverso da NULL */
+typedef struct {
+    MultiQueue *mq;
+    MinHeap *h;
+    pthread_mutex_t *lock; /* mutex che protegge h */
+    int ops;
+    uint32_t rng;
+} Worker;
+
+static void *hold_worker(void *arg)
+{
+    Worker *w = (Worker*)arg;
+    double now = 0.0;
+    int i, key, ok = 1;
+
+    for (i=0; i<w->ops; i++) {
+        if (w->mq != NULL) {
+            ok = multiqueue_delete_min(w->mq, &key, &now, &w->rng);
+            assert(ok);
+            multiqueue_insert(w->mq, key, now + randunif(&w->rng), &w->rng);
+        } else {
+            pthread_mutex_lock(w->lock);
+            now = minheap_min_prio(w->h);
+            key = minheap_delete_min(w->h);
+            minheap_insert(w->h, key, now + randunif(&w->rng));
+            pthread_mutex_unlock(w->lock);
+        }
+    }
+    (void)ok;
+    return NULL;
+}
+
+/* Esegue m operazioni di estrazione e reinserimento, ripartite tra
+   `nthreads` thread, su una MultiQueue (se `use_mq` != 0) oppure su
+   un MinHeap protetto da un mutex, che contengono inizialmente n
+   coppie. Restituisce il tempo impiegato. */
+static double bench_hold(int n, int m, int nthreads, int use_mq)
+{
+    Worker w[MAX_THREADS];
+    pthread_t tid[MAX_THREADS];
+    pthread_mutex_t lock;
+    MultiQueue *mq = NULL;
+    MinHeap *h = NULL;
+    char *seen;
+    uint32_t rng;
+    double tstart, elapsed;
+    int i, t, key;
+
+    multiqueue_seed(&rng, 12345);
+    pthread_mutex_init(&lock, NULL);
+    if (use_mq) {
+        mq = multiqueue_create(n, nthreads);
+        for (i=0; i<n; i++) {
+            multiqueue_insert(mq, i, randunif(&rng), &rng);
+        }
+    } else {
+        h = minheap_create(n);
+        for (i=0; i<n; i++) {
+            minheap_insert(h, i, randunif(&rng));
+        }
+    }
+
+    tstart = wall_time();
+    for (t=0; t<nthreads; t++) {
+        w[t].mq = mq;
+        w[t].h = h;
+        w[t].lock = &lock;
+        w[t].ops = m / nthreads + (t < m % nthreads);
+        multiqueue_seed(&w[t].rng, (uint32_t)(t + 1) * 2654435761u);
+        if (pthread_create(&tid[t], NULL, hold_worker, &w[t]) != 0) {
+            fprintf(stderr, "Can not create thread\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+    for (t=0; t<nthreads; t++) {
+        pthread_join(tid[t], NULL);
+    }
+    elapsed = wall_time() - tstart;
+
+    /* Verifica: ogni chiave deve essere presente una sola volta */
+    seen = (char*)calloc(n, 1);
+    assert(seen != NULL);
+    for (i=0; i<n; i++) {
+        if (use_mq) {
+            const int ok = multiqueue_delete_min(mq, &key, NULL, &rng);
+            assert(ok);
+            (void)ok;
+        } else {
+            key = minheap_delete_min(h);
+        }
+        assert(key >= 0 && key < n && !seen[key]);
+        seen[key] = 1;
+    }
+    if (use_mq) {
+        assert(!multiqueue_delete_min(mq, &key, NULL, &rng));
+        multiqueue_destroy(mq);
+    } else {
+        assert(minheap_is_empty(h));
+        minheap_destroy(h);
+    }
+    free(seen);
+    pthread_mutex_destroy(&lock);
+    return elapsed;
+}
+
+/* Rango medio delle coppie estratte da una MultiQueue creata per
+   `nthreads` thread e usata da un solo thread, con n coppie e m
+   estrazioni; il rango viene calcolato esaminando le priorità di
+   tutte le coppie presenti, per cui n deve essere piccolo. */
+static double mean_rank(int n, int m, int nthreads)
+{
+    MultiQueue *mq = multiqueue_create(n, nthreads);
+    double *prio = (double*)malloc(n * sizeof(*prio));
+    double p, sum = 0.0;
+    uint32_t rng;
+    int i, j, key, rank;
+
+    assert(prio != NULL);
+    multiqueue_seed(&rng, 6789);
+    for (i=0; i<n; i++) {
+        prio[i] = randunif(&rng);
+        multiqueue_insert(mq, i, prio[i], &rng);
+    }
+    for (i=0; i<m; i++) {
+        multiqueue_delete_min(mq, &key, &p, &rng);
+        rank = 0;
+        for (j=0; j<n; j++) {
+            rank += (j != key && prio[j] < p);
+        }
+        sum += rank;
+        prio[key] = p + randunif(&rng);
+        multiqueue_insert(mq, key, prio[key], &rng);
+    }
+    multiqueue_destroy(mq);
+    free(prio);
+    return sum / m;
+}
+
+int main( int argc, char *argv[] )
+{
+    int n = 1000000, m = 4000000, maxthreads = 8, p;
+
+    if (argc > 4) {
+        fprintf(stderr, "Usage: %s [n [m [maxthreads]]]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 1) {
+        n = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        m = atoi(argv[2]);
+    }
+    if (argc > 3) {
+        maxthreads = atoi(argv[3]);
+    }
+    if (n < MAX_THREADS || m < 0 || maxthreads < 1 || maxthreads > MAX_THREADS) {
+        fprintf(stderr, "Invalid arguments\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("hold, n=%d, m=%d (wall clock seconds)\n", n, m);
+    printf("threads  MinHeap+mutex  MultiQueue\n");
+    for (p=1; p<=maxthreads; p *= 2) {
+        const double t_heap = bench_hold(n, m, p, 0);
+        const double t_mq = bench_hold(n, m, p, 1);
+        printf("%7d  %13f  %10f\n", p, t_heap, t_mq);
+    }
+
+    printf("\nmean rank of extracted pairs, n=10000, one thread\n");
+    printf("queues  rank\n");
+    for (p=1; p<=maxthreads; p *= 2) {
+        printf("%6d  %f\n", MULTIQUEUE_C * p, mean_rank(10000, 10000, p));
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,264 @@
+/****************************************************************************
+ *
+ * multiqueue.c -- Coda di priorità concorrente MultiQueue
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - MultiQueue: una coda di priorità concorrente
+% Ultimo aggiornamento: 2026-10-19
+
+Uno heap può essere condiviso tra più thread proteggendolo con un
+mutex, ma in questo modo le operazioni vengono eseguite una alla
+volta: aggiungendo thread il throughput non aumenta, anzi di solito
+diminuisce a causa della contesa sul mutex.
+
+La _MultiQueue_ (Rihani, Sanders, Dementiev, 2015) rinuncia
+all'ordinamento esatto: è composta da $c \cdot p$ heap indipendenti
+(`MinHeap`), dove $p$ è il numero di thread e $c$ una piccola
+costante (`MULTIQUEUE_C`, default 2), ciascuno protetto dal proprio
+mutex.
+
+- `multiqueue_insert()` sceglie uno heap a caso e vi inserisce la
+  coppia;
+
+- `multiqueue_delete_min()` sceglie due heap a caso e rimuove la
+  coppia di priorità minore tra i loro due minimi.
+
+Entrambe le operazioni acquisiscono i mutex con
+`pthread_mutex_trylock()`: se uno heap è in uso da parte di un altro
+thread, anziché attendere se ne sceglie un altro. Poiché gli heap
+sono molti più dei thread, i conflitti sono rari e il throughput
+cresce con il numero di thread.
+
+La coppia rimossa non è necessariamente la minima di tutta la coda,
+ma il suo rango (il numero di coppie con priorità minore) è in media
+proporzionale al numero di heap; la scelta tra _due_ heap anziché uno
+solo evita che alcuni heap accumulino coppie con priorità piccole.
+Questo rilassamento è accettabile in molte applicazioni, come
+l'algoritmo di Dijkstra parallelo o lo scheduling di task con
+priorità.
+
+Le chiavi di ogni `MinHeap` sono gli indici degli _slot_ di quello
+heap; lo slot contiene la chiave dell'utente, per cui le chiavi
+possono essere interi arbitrari e ciascun heap ha dimensione pari a
+circa $2 \cdot \mathit{size} / (c \cdot p)$. Ogni heap occupa un
+numero intero di linee di cache (`MQShardLine`) e l'array degli heap
+è allocato con `posix_memalign()` all'inizio di una linea, per cui
+due heap non condividono mai la stessa linea di cache ("false
+sharing").
+
+Se i due heap scelti risultano più volte entrambi vuoti,
+`multiqueue_delete_min()` li esamina tutti, in ordine, prima di
+concludere che la coda è vuota.
+
+Per compilare è necessario il supporto ai thread POSIX (`-pthread`);
+si veda [multiqueue-bench.c](multiqueue-bench.c).
+
+## File
+
+- [multiqueue.c](multiqueue.c)
+- [multiqueue.h](multiqueue.h)
+- [minheap.c](minheap.c)
+- [minheap.h](minheap.h)
+
+***/
+
+#define _POSIX_C_SOURCE 200112L /* posix_memalign() */
+#include <stdlib.h>
+#include <assert.h>
+#include "multiqueue.h"
+
+/* Numero di tentativi in cui entrambi gli heap scelti sono vuoti dopo
+   i quali `multiqueue_delete_min()` li esamina tutti */
+#define MULTIQUEUE_EMPTY_TRIES 4
+
+void multiqueue_seed(uint32_t *rng, uint32_t seed)
+{
+    assert(rng != NULL);
+
+    *rng = (seed != 0 ? seed : 0x9E3779B9u);
+}
+
+/* Funzione di supporto: restituisce un intero pseudocasuale in [0,
+   m) (generatore xorshift) */
+static int rand_index(uint32_t *rng, int m)
+{
+    uint32_t x = *rng;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *rng = x;
+    return (int)(x % (uint32_t)m);
+}
+
+MultiQueue *multiqueue_create(int size, int nthreads)
+{
+    MultiQueue *q = (MultiQueue*)malloc(sizeof(*q));
+    int i, s;
+
+    assert(q != NULL);
+    assert(size > 0);
+    assert(nthreads > 0);
+
+    q->size = size;
+    q->nshards = MULTIQUEUE_C * nthreads;
+    /* la capacità complessiva degli heap è circa il doppio di `size`,
+       per cui finché la coda non è piena c'è sempre almeno uno heap
+       non pieno */
+    q->shard_size = 2 * ((size + q->nshards - 1) / q->nshards);
+    if (posix_memalign((void**)&(q->shard), MULTIQUEUE_LINE,
+                       q->nshards * sizeof(*(q->shard))) != 0) {
+        q->shard = NULL;
+    }
+    assert(q->shard != NULL);
+    for (i=0; i<q->nshards; i++) {
+        MQShard *sh = &q->shard[i].s;
+        pthread_mutex_init(&sh->lock, NULL);
+        sh->h = minheap_create(q->shard_size);
+        sh->val = (int*)malloc(q->shard_size * sizeof(*(sh->val)));
+        sh->free_slot = (int*)malloc(q->shard_size * sizeof(*(sh->free_slot)));
+        assert(sh->val != NULL && sh->free_slot != NULL);
+        for (s=0; s<q->shard_size; s++) {
+            sh->free_slot[s] = q->shard_size - 1 - s;
+        }
+        sh->nfree = q->shard_size;
+    }
+    return q;
+}
+
+void multiqueue_destroy(MultiQueue *q)
+{
+    int i;
+
+    assert(q != NULL);
+
+    for (i=0; i<q->nshards; i++) {
+        pthread_mutex_destroy(&q->shard[i].s.lock);
+        minheap_destroy(q->shard[i].s.h);
+        free(q->shard[i].s.val);
+        free(q->shard[i].s.free_slot);
+    }
+    free(q->shard);
+    free(q);
+}
+
+void multiqueue_insert(MultiQueue *q, int key, double prio, uint32_t *rng)
+{
+    MQShard *sh;
+    int slot;
+
+    assert(q != NULL);
+    assert(rng != NULL);
+
+    while (1) {
+        sh = &q->shard[rand_index(rng, q->nshards)].s;
+        if (pthread_mutex_trylock(&sh->lock) != 0)
+            continue;
+        if (sh->nfree > 0)
+            break;
+        pthread_mutex_unlock(&sh->lock);
+    }
+    slot = sh->free_slot[--(sh->nfree)];
+    sh->val[slot] = key;
+    minheap_insert(sh->h, slot, prio);
+    pthread_mutex_unlock(&sh->lock);
+}
+
+/* Funzione di supporto: rimuove il minimo dello heap `sh`, che deve
+   essere bloccato dal thread chiamante e non vuoto */
+static void pop_shard(MQShard *sh, int *key, double *prio)
+{
+    int slot;
+
+    if (prio != NULL) {
+        *prio = minheap_min_prio(sh->h);
+    }
+    slot = minheap_delete_min(sh->h);
+    *key = sh->val[slot];
+    sh->free_slot[(sh->nfree)++] = slot;
+}
+
+int multiqueue_delete_min(MultiQueue *q, int *key, double *prio, uint32_t *rng)
+{
+    int empty_tries = 0, i, j, start;
+
+    assert(q != NULL);
+    assert(key != NULL);
+    assert(rng != NULL);
+
+    while (empty_tries < MULTIQUEUE_EMPTY_TRIES) {
+        MQShard *a, *b, *best = NULL;
+
+        i = rand_index(rng, q->nshards);
+        a = &q->shard[i].s;
+        if (pthread_mutex_trylock(&a->lock) != 0)
+            continue;
+        b = NULL;
+        if (q->nshards > 1) {
+            j = rand_index(rng, q->nshards - 1);
+            j = (j >= i ? j + 1 : j); /* j != i */
+            b = &q->shard[j].s;
+            if (pthread_mutex_trylock(&b->lock) != 0)
+                b = NULL; /* ci si accontenta del solo heap a */
+        }
+        if (!minheap_is_empty(a->h))
+            best = a;
+        if (b != NULL && !minheap_is_empty(b->h) &&
+            (best == NULL || minheap_min_prio(b->h) < minheap_min_prio(best->h)))
+            best = b;
+        if (best != NULL) {
+            pop_shard(best, key, prio);
+        }
+        if (b != NULL)
+            pthread_mutex_unlock(&b->lock);
+        pthread_mutex_unlock(&a->lock);
+        if (best != NULL)
+            return 1;
+        empty_tries++;
+    }
+
+    /* La coda è forse vuota: si esaminano tutti gli heap */
+    start = rand_index(rng, q->nshards);
+    for (i=0; i<q->nshards; i++) {
+        MQShard *sh = &q->shard[(start + i) % q->nshards].s;
+        pthread_mutex_lock(&sh->lock);
+        if (!minheap_is_empty(sh->h)) {
+            pop_shard(sh, key, prio);
+            pthread_mutex_unlock(&sh->lock);
+            return 1;
+        }
+        pthread_mutex_unlock(&sh->lock);
+    }
+    return 0;
+}
+
+int multiqueue_get_n(MultiQueue *q)
+{
+    int i, n = 0;
+
+    assert(q != NULL);
+
+    for (i=0; i<q->nshards; i++) {
+        pthread_mutex_lock(&q->shard[i].s.lock);
+        n += minheap_get_n(q->shard[i].s.h);
+        pthread_mutex_unlock(&q->shard[i].s.lock);
+    }
+    return n;
+}
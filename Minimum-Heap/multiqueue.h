@@ -0,0 +1,103 @@
+/****************************************************************************
+ *
+ * multiqueue.h -- Interfaccia MultiQueue
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef MULTIQUEUE_H
+#define MULTIQUEUE_H
+
+#include <stdint.h>
+#include <pthread.h>
+#include "minheap.h"
+
+/* Numero di heap per ciascun thread: una MultiQueue per `p` thread
+   è composta da MULTIQUEUE_C * p heap */
+#ifndef MULTIQUEUE_C
+#define MULTIQUEUE_C 2
+#endif
+
+/* Dimensione (in byte) di una linea di cache */
+#ifndef MULTIQUEUE_LINE
+#define MULTIQUEUE_LINE 64
+#endif
+
+/* Uno degli heap della MultiQueue. Le chiavi dello heap sono gli
+   indici degli slot, cioè delle posizioni di val[]; val[s] è la
+   chiave dell'utente memorizzata nello slot s. */
+typedef struct {
+    pthread_mutex_t lock;
+    MinHeap *h;
+    int *val; /* val[s] è la chiave memorizzata nello slot s */
+    int *free_slot; /* pila degli slot liberi */
+    int nfree; /* numero di slot liberi */
+} MQShard;
+
+/* Uno heap occupa un numero intero di linee di cache; poiché l'array
+   degli heap è allineato a MULTIQUEUE_LINE byte, due heap non
+   condividono mai la stessa linea */
+typedef union {
+    MQShard s;
+    char line[(sizeof(MQShard) + MULTIQUEUE_LINE - 1) / MULTIQUEUE_LINE * MULTIQUEUE_LINE];
+} MQShardLine;
+
+typedef struct {
+    MQShardLine *shard; /* array allineato a MULTIQUEUE_LINE byte */
+    int nshards; /* numero di heap */
+    int shard_size; /* capacità di ciascuno heap */
+    int size; /* massimo numero di coppie (chiave, prio) */
+} MultiQueue;
+
+/* Crea una MultiQueue vuota, destinata ad essere usata da (al più)
+   `nthreads` thread, in grado di contenere al più `size` coppie
+   (chiave, priorità). Le chiavi sono interi arbitrari, che possono
+   anche ripetersi; la coda non offre operazioni che cercano una
+   chiave.
+
+   Precondizioni: size > 0, nthreads > 0 */
+MultiQueue *multiqueue_create(int size, int nthreads);
+
+/* Dealloca la coda; nessun thread deve usarla in quel momento */
+void multiqueue_destroy(MultiQueue *q);
+
+/* Inizializza lo stato `rng` del generatore pseudocasuale usato dal
+   thread chiamante nelle operazioni seguenti; ogni thread deve avere
+   il proprio stato, con un valore di `seed` diverso */
+void multiqueue_seed(uint32_t *rng, uint32_t seed);
+
+/* Inserisce la coppia (key, prio). Può essere invocata da più thread
+   contemporaneamente.
+
+   Precondizione: la coda contiene meno di `size` coppie. */
+void multiqueue_insert(MultiQueue *q, int key, double prio, uint32_t *rng);
+
+/* Rimuove una coppia con priorità "quasi" minima e ne scrive chiave e
+   priorità in *key e *prio (quest'ultimo può essere NULL).
+   Restituisce 1 se ha rimosso una coppia, 0 se la coda era vuota.
+   Può essere invocata da più thread contemporaneamente.
+
+   La coppia rimossa è la minima di uno di due heap scelti a caso,
+   quindi in generale non è la minima di tutta la coda: il suo rango
+   è in media O(numero di heap). */
+int multiqueue_delete_min(MultiQueue *q, int *key, double *prio, uint32_t *rng);
+
+/* Restituisce il numero di coppie presenti; il valore è esatto solo
+   se nessun altro thread sta modificando la coda */
+int multiqueue_get_n(MultiQueue *q);
+
+#endif
@@ -0,0 +1,114 @@
+/****************************************************************************
+ *
+ * pairheap-main.c -- Test del Pairing Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "pairheap.h"
+
+int main( int argc, char *argv[] )
+{
+    char op;
+    int n, m, i, key;
+    double prio;
+    PairPool *pool;
+    PairHeap *h, *h2;
+    FILE *filein = stdin;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s inputfile\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "-") != 0) {
+        filein = fopen(argv[1], "r");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (1 != fscanf(filein, "%d", &n)) {
+        fprintf(stderr, "Missing size\n");
+        return EXIT_FAILURE;
+    }
+    printf("pairheap_create(%d)\n", n);
+    pool = pairpool_create(n);
+    h = pairheap_create(pool);
+
+    while (1 == fscanf(filein, " %c", &op)) {
+        switch (op) {
+        case '+': /* insert */
+            fscanf(filein, "%d %lf", &key, &prio);
+            printf("pairheap_insert(h, %d, %f)\n", key, prio);
+            pairheap_insert(h, key, prio);
+            break;
+        case '-': /* delete min */
+            key = pairheap_delete_min(h);
+            printf("pairheap_delete_min(h) = %d\n", key);
+            break;
+        case '?': /* get min */
+            key = pairheap_min(h);
+            printf("pairheap_min(h) = %d\n", key);
+            break;
+        case 'c': /* change prio */
+            fscanf(filein, "%d %lf", &key, &prio);
+            printf("pairheap_change_prio(h, %d, %f)\n", key, prio);
+            pairheap_change_prio(h, key, prio);
+            break;
+        case 'r': /* remove */
+            fscanf(filein, "%d", &key);
+            printf("pairheap_remove(h, %d)\n", key);
+            pairheap_remove(h, key);
+            break;
+        case 'k': /* contains */
+            fscanf(filein, "%d", &key);
+            printf("pairheap_contains(h, %d) = %d\n", key, pairheap_contains(h, key));
+            break;
+        case 'm': /* meld */
+            fscanf(filein, "%d", &m);
+            h2 = pairheap_create(pool);
+            for (i=0; i<m; i++) {
+                fscanf(filein, "%d %lf", &key, &prio);
+                pairheap_insert(h2, key, prio);
+            }
+            printf("pairheap_meld(h, h2), %d elements\n", m);
+            pairheap_meld(h, h2);
+            pairheap_destroy(h2);
+            break;
+        case 's': /* get n of elements */
+            printf("pairheap_get_n(h) = %d\n", pairheap_get_n(h));
+            break;
+        case 'p': /* print */
+            pairheap_print(h);
+            break;
+        default:
+            printf("Unknown command %c\n", op);
+            return EXIT_FAILURE;
+        }
+    }
+
+    pairheap_destroy(h);
+    pairpool_destroy(pool);
+    if (filein != stdin) fclose(filein);
+
+    return EXIT_SUCCESS;
+}
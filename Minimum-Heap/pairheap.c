@@ -0,0 +1,435 @@
+/****************************************************************************
+ *
+ * pairheap.c -- Pairing Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Pairing Heap
+% Ultimo aggiornamento: 2026-10-19
+
+Un _pairing heap_ è un albero (non necessariamente binario) in cui
+ogni nodo ha priorità minore o uguale a quella dei suoi figli. Tutte
+le operazioni si basano sull'operazione di _collegamento_ (`link()`)
+di due alberi: la radice con priorità maggiore diventa il primo
+figlio dell'altra. Quindi:
+
+- `pairheap_insert()` collega la radice con un nuovo albero di un solo
+  nodo: tempo $O(1)$;
+
+- `pairheap_meld()` collega le radici dei due heap: tempo $O(1)$;
+
+- `pairheap_change_prio()`, se la priorità diminuisce, stacca il
+  sottoalbero radicato nel nodo e lo collega alla radice: tempo
+  $O(1)$. Se la priorità aumenta, il nodo viene rimosso e reinserito;
+
+- `pairheap_delete_min()` rimuove la radice e unisce i suoi figli in
+  due passate: nella prima i figli vengono collegati a coppie da
+  sinistra a destra; nella seconda gli alberi ottenuti vengono
+  collegati da destra a sinistra. Il costo ammortizzato è $O(\log
+  n)$.
+
+In pratica i pairing heap sono tra le code di priorità più veloci
+quando le operazioni di riduzione della priorità sono frequenti (ad
+esempio nell'algoritmo di Dijkstra), perché non spostano elementi in
+un array come `move_up()` in [minheap.c](minheap.c).
+
+I nodi sono allocati da un _pool_ (`PairPool`) a blocchi di
+`PAIRPOOL_BLOCK` nodi; i nodi liberati vengono inseriti in una lista
+e riutilizzati, per cui non si invoca `malloc()` per ogni
+inserimento. Il pool contiene anche l'array `node[]` che associa a
+ciascuna chiave il suo nodo, che svolge il ruolo di `pos[]` in
+`MinHeap`. Più heap possono condividere lo stesso pool, ed è questo
+che consente di unire due heap in tempo costante.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic pairheap.c pairheap-main.c -o pairheap-main
+
+Per eseguire:
+
+        ./pairheap-main inputfile
+
+dove `inputfile` contiene gli stessi comandi accettati da
+[minheap-main.c](minheap-main.c) (esclusi `b`, `i` e `d`), compreso
+il comando `m`, che inserisce le coppie indicate in un secondo heap e
+lo unisce al primo con `pairheap_meld()`.
+
+## File
+
+- [pairheap.c](pairheap.c)
+- [pairheap.h](pairheap.h)
+- [pairheap-main.c](pairheap-main.c)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include "pairheap.h"
+
+/* Numero di nodi allocati insieme dal pool */
+#define PAIRPOOL_BLOCK 1024
+
+PairPool *pairpool_create(int size)
+{
+    PairPool *pool = (PairPool*)malloc(sizeof(*pool));
+    int i;
+
+    assert(pool != NULL);
+    assert(size > 0);
+
+    pool->size = size;
+    pool->node = (PairNode**)malloc(size * sizeof(*(pool->node)));
+    assert(pool->node != NULL);
+    for (i=0; i<size; i++) {
+        pool->node[i] = NULL;
+    }
+    pool->nblocks = 0;
+    pool->maxblocks = 1 + (size - 1) / PAIRPOOL_BLOCK;
+    pool->blocks = (PairNode**)malloc(pool->maxblocks * sizeof(*(pool->blocks)));
+    assert(pool->blocks != NULL);
+    pool->free_list = NULL;
+    return pool;
+}
+
+void pairpool_destroy(PairPool *pool)
+{
+    int b;
+
+    assert(pool != NULL);
+
+    for (b=0; b<pool->nblocks; b++) {
+        free(pool->blocks[b]);
+    }
+    free(pool->blocks);
+    free(pool->node);
+    free(pool);
+}
+
+/* Funzione di supporto: preleva un nodo dal pool. Poiché ogni chiave
+   occupa al più un nodo, bastano maxblocks blocchi. */
+static PairNode *node_alloc(PairPool *pool)
+{
+    PairNode *x;
+
+    if (pool->free_list == NULL) {
+        PairNode *blk;
+        int i;
+        assert(pool->nblocks < pool->maxblocks);
+        blk = (PairNode*)malloc(PAIRPOOL_BLOCK * sizeof(*blk));
+        assert(blk != NULL);
+        pool->blocks[pool->nblocks++] = blk;
+        for (i=0; i<PAIRPOOL_BLOCK; i++) {
+            blk[i].next = pool->free_list;
+            pool->free_list = &blk[i];
+        }
+    }
+    x = pool->free_list;
+    pool->free_list = x->next;
+    return x;
+}
+
+/* Funzione di supporto: restituisce un nodo al pool */
+static void node_free(PairPool *pool, PairNode *x)
+{
+    pool->node[x->key] = NULL;
+    x->next = pool->free_list;
+    pool->free_list = x;
+}
+
+PairHeap *pairheap_create(PairPool *pool)
+{
+    PairHeap *h = (PairHeap*)malloc(sizeof(*h));
+
+    assert(h != NULL);
+    assert(pool != NULL);
+    h->root = NULL;
+    h->pool = pool;
+    h->n = 0;
+    return h;
+}
+
+/* Funzione di supporto: restituisce al pool tutti i nodi
+   dell'albero radicato in x (e dei suoi fratelli successivi). Non si
+   usa la ricorsione, perché l'albero può avere altezza O(n): il primo
+   figlio di x viene staccato e posto davanti ad x nella lista, che
+   viene elaborata fino a quando non contiene solo foglie. */
+static void free_tree(PairPool *pool, PairNode *x)
+{
+    PairNode *c;
+
+    while (x != NULL) {
+        c = x->child;
+        if (c != NULL) {
+            x->child = c->next;
+            c->next = x;
+            x = c;
+        } else {
+            c = x->next;
+            node_free(pool, x);
+            x = c;
+        }
+    }
+}
+
+void pairheap_clear(PairHeap *h)
+{
+    assert(h != NULL);
+
+    free_tree(h->pool, h->root);
+    h->root = NULL;
+    h->n = 0;
+}
+
+void pairheap_destroy(PairHeap *h)
+{
+    pairheap_clear(h);
+    free(h);
+}
+
+int pairheap_is_empty(const PairHeap *h)
+{
+    assert(h != NULL);
+
+    return (h->n == 0);
+}
+
+int pairheap_get_n(const PairHeap *h)
+{
+    assert(h != NULL);
+
+    return h->n;
+}
+
+int pairheap_min(const PairHeap *h)
+{
+    assert( !pairheap_is_empty(h) );
+
+    return h->root->key;
+}
+
+double pairheap_min_prio(const PairHeap *h)
+{
+    assert( !pairheap_is_empty(h) );
+
+    return h->root->prio;
+}
+
+int pairheap_contains(const PairHeap *h, int key)
+{
+    assert(h != NULL);
+
+    return (key >= 0) && (key < h->pool->size) && (h->pool->node[key] != NULL);
+}
+
+double pairheap_get_prio(const PairHeap *h, int key)
+{
+    assert(pairheap_contains(h, key));
+
+    return h->pool->node[key]->prio;
+}
+
+/* Funzione di supporto: collega due alberi (ciascuno può essere
+   NULL); la radice con priorità maggiore diventa il primo figlio
+   dell'altra. Restituisce la nuova radice, i cui campi `next` e
+   `prev` non sono significativi. */
+static PairNode *link(PairNode *a, PairNode *b)
+{
+    if (a == NULL) return b;
+    if (b == NULL) return a;
+    if (b->prio < a->prio) {
+        PairNode *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    b->prev = a;
+    b->next = a->child;
+    if (a->child != NULL) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    return a;
+}
+
+/* Funzione di supporto: stacca il sottoalbero radicato in x (che non
+   è la radice) dalla lista dei fratelli */
+static void cut(PairNode *x)
+{
+    if (x->prev->child == x) {
+        x->prev->child = x->next;
+    } else {
+        x->prev->next = x->next;
+    }
+    if (x->next != NULL) {
+        x->next->prev = x->prev;
+    }
+    x->next = x->prev = NULL;
+}
+
+/* Funzione di supporto: unisce in un unico albero la lista di
+   fratelli che inizia con `first`, con il metodo a due passate */
+static PairNode *merge_pairs(PairNode *first)
+{
+    PairNode *pairs = NULL, *a, *b, *result = NULL;
+
+    /* Prima passata: da sinistra a destra, si collegano gli alberi a
+       coppie; i risultati vengono accumulati in una pila (concatenata
+       tramite `next`), per cui la seconda passata li visita in ordine
+       inverso */
+    while (first != NULL) {
+        a = first;
+        b = a->next;
+        first = (b != NULL ? b->next : NULL);
+        a = link(a, b);
+        a->next = pairs;
+        pairs = a;
+    }
+    /* Seconda passata: da destra a sinistra */
+    while (pairs != NULL) {
+        a = pairs;
+        pairs = pairs->next;
+        result = link(result, a);
+    }
+    if (result != NULL) {
+        result->next = result->prev = NULL;
+    }
+    return result;
+}
+
+void pairheap_insert(PairHeap *h, int key, double prio)
+{
+    PairNode *x;
+
+    assert(h != NULL);
+    assert((key >= 0) && (key < h->pool->size));
+    assert( !pairheap_contains(h, key) );
+
+    x = node_alloc(h->pool);
+    x->key = key;
+    x->prio = prio;
+    x->child = x->next = x->prev = NULL;
+    h->pool->node[key] = x;
+    h->root = link(h->root, x);
+    h->n++;
+}
+
+int pairheap_delete_min(PairHeap *h)
+{
+    PairNode *r;
+    int ret;
+
+    assert( !pairheap_is_empty(h) );
+
+    r = h->root;
+    ret = r->key;
+    h->root = merge_pairs(r->child);
+    node_free(h->pool, r);
+    h->n--;
+    return ret;
+}
+
+/* Funzione di supporto: stacca dallo heap il nodo x, riunendo i suoi
+   figli allo heap; x non viene restituito al pool */
+static void detach(PairHeap *h, PairNode *x)
+{
+    PairNode *children;
+
+    if (x == h->root) {
+        h->root = merge_pairs(x->child);
+    } else {
+        cut(x);
+        children = merge_pairs(x->child);
+        h->root = link(h->root, children);
+    }
+    x->child = NULL;
+}
+
+void pairheap_change_prio(PairHeap *h, int key, double newprio)
+{
+    PairNode *x;
+
+    assert(h != NULL);
+    assert(pairheap_contains(h, key));
+
+    x = h->pool->node[key];
+    if (newprio < x->prio) {
+        x->prio = newprio;
+        if (x != h->root) {
+            cut(x);
+            h->root = link(h->root, x);
+        }
+    } else if (newprio > x->prio) {
+        detach(h, x);
+        x->prio = newprio;
+        x->next = x->prev = NULL;
+        h->root = link(h->root, x);
+    }
+}
+
+void pairheap_remove(PairHeap *h, int key)
+{
+    PairNode *x;
+
+    assert(h != NULL);
+    assert(pairheap_contains(h, key));
+
+    x = h->pool->node[key];
+    detach(h, x);
+    node_free(h->pool, x);
+    h->n--;
+}
+
+void pairheap_meld(PairHeap *h1, PairHeap *h2)
+{
+    assert(h1 != NULL && h2 != NULL);
+    assert(h1->pool == h2->pool);
+
+    if (h1 == h2) {
+        return;
+    }
+    h1->root = link(h1->root, h2->root);
+    h1->n += h2->n;
+    h2->root = NULL;
+    h2->n = 0;
+}
+
+/* Funzione di supporto: stampa l'albero radicato in x con
+   indentazione proporzionale alla profondità */
+static void print_tree(const PairNode *x, int depth)
+{
+    int i;
+
+    for ( ; x != NULL; x = x->next) {
+        for (i=0; i<depth; i++) {
+            printf("  ");
+        }
+        printf("(%d, %6.2f)\n", x->key, x->prio);
+        print_tree(x->child, depth + 1);
+    }
+}
+
+void pairheap_print(const PairHeap *h)
+{
+    assert(h != NULL);
+
+    printf("\n** Contenuto dello heap:\n\n");
+    printf("n=%d\n", h->n);
+    print_tree(h->root, 0);
+    printf("\n\n** Fine contenuto dello heap\n\n");
+}
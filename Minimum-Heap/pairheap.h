@@ -0,0 +1,132 @@
+/****************************************************************************
+ *
+ * pairheap.h -- Interfaccia Pairing Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef PAIRHEAP_H
+#define PAIRHEAP_H
+
+/* Nodo di un pairing heap: i figli di un nodo formano una lista
+   doppiamente concatenata; `prev` punta al fratello precedente,
+   oppure al padre se il nodo è il primo figlio. */
+typedef struct PairNode {
+    double prio;
+    int key;
+    struct PairNode *child; /* primo figlio */
+    struct PairNode *next; /* fratello successivo */
+    struct PairNode *prev; /* fratello precedente o padre */
+} PairNode;
+
+/* Pool di nodi condiviso da uno o più pairing heap. Le chiavi sono gli
+   interi 0 .. size-1; ogni chiave può essere presente in al più uno
+   degli heap che usano il pool. I nodi vengono allocati a blocchi,
+   e quelli liberati vengono riutilizzati. */
+typedef struct {
+    PairNode **node; /* node[k] è il nodo di chiave k, o NULL */
+    PairNode **blocks; /* blocchi di nodi allocati */
+    int nblocks, maxblocks;
+    PairNode *free_list; /* nodi liberi, concatenati tramite `next` */
+    int size;
+} PairPool;
+
+typedef struct {
+    PairNode *root;
+    PairPool *pool;
+    int n; /* numero di coppie (chiave, prio) presenti nello heap */
+} PairHeap;
+
+/* Crea un pool per chiavi comprese tra 0 e `size`-1.
+
+   Precondizione: size > 0 */
+PairPool *pairpool_create(int size);
+
+/* Dealloca il pool; gli heap che lo usano devono essere già stati
+   distrutti */
+void pairpool_destroy(PairPool *pool);
+
+/* Crea un pairing heap vuoto i cui nodi provengono da `pool` */
+PairHeap *pairheap_create(PairPool *pool);
+
+/* Svuota lo heap, restituendo i nodi al pool */
+void pairheap_clear(PairHeap *h);
+
+/* Svuota e dealloca lo heap */
+void pairheap_destroy(PairHeap *h);
+
+/* Restituisce 1 se e solo se lo heap è vuoto */
+int pairheap_is_empty(const PairHeap *h);
+
+/* Ritorna il numero di elementi effettivamente presenti nello heap */
+int pairheap_get_n(const PairHeap *h);
+
+/* Restituisce la chiave associata alla minima priorità; non modifica
+   lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int pairheap_min(const PairHeap *h);
+
+/* Restituisce la minima priorità; non modifica lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+double pairheap_min_prio(const PairHeap *h);
+
+/* Restituisce la priorità associata alla chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+double pairheap_get_prio(const PairHeap *h, int key);
+
+/* Inserisce una nuova chiave `key` con priorità `prio`; tempo O(1).
+
+   Precondizioni:
+   - `key` deve essere una chiave valida per il pool;
+   - `key` non deve essere presente in alcuno heap del pool. */
+void pairheap_insert(PairHeap *h, int key, double prio);
+
+/* Rimuove dallo heap la coppia (chiave, prio) con priorità minima, e
+   restituisce la chiave di tale coppia; tempo O(log n) ammortizzato.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int pairheap_delete_min(PairHeap *h);
+
+/* Modifica la priorità associata alla chiave `key`. Se la priorità
+   diminuisce il tempo è O(1) (il limite ammortizzato dimostrato è
+   o(log n)), altrimenti O(log n) ammortizzato.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+void pairheap_change_prio(PairHeap *h, int key, double new_prio);
+
+/* Restituisce 1 se e solo se la chiave `key` è presente in uno degli
+   heap che usano il pool di `h` */
+int pairheap_contains(const PairHeap *h, int key);
+
+/* Rimuove dallo heap la coppia (chiave, prio) di chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+void pairheap_remove(PairHeap *h, int key);
+
+/* Sposta tutte le coppie di `h2` in `h1`, in tempo O(1); `h2` rimane
+   vuoto.
+
+   Precondizione: `h1` e `h2` devono usare lo stesso pool */
+void pairheap_meld(PairHeap *h1, PairHeap *h2);
+
+/* Stampa il contenuto dello heap */
+void pairheap_print(const PairHeap *h);
+
+#endif
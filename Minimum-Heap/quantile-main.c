@@ -0,0 +1,138 @@
+/****************************************************************************
+ *
+ * quantile-main.c -- Mediana e percentili di una sequenza
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Legge una sequenza di numeri reali, separati da spazi o da
+   ritorni a capo, da un file o dallo standard input, e ne calcola
+   la mediana o i quantili richiesti con l'opzione -q (che può essere
+   ripetuta). Con l'opzione -e, ogni `every` valori stampa una riga
+   con il numero di valori letti fino a quel momento e i quantili
+   correnti; al termine stampa, se non l'ha già fatto, una riga con i
+   quantili di tutta la sequenza.
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread minheap.c valreader.c quantile.c quantile-main.c -o quantile-main
+
+   Per eseguire:
+
+        ./quantile-main [-q q]... [-e every] [inputfile]
+
+   ad esempio `./quantile-main -q 0.5 -q 0.99 -e 1000000 data.txt`.
+   Il nome "-", o l'assenza del nome, indica lo standard input. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "valreader.h"
+#include "quantile.h"
+
+#define BATCH 4096
+#define MAX_QUANTILES 16
+
+static void print_quantiles(RunQuantile **r, int nq)
+{
+    int j;
+
+    printf("%d", runquantile_get_n(r[0]));
+    for (j=0; j<nq; j++) {
+        printf(" %f", runquantile_get(r[j]));
+    }
+    printf("\n");
+}
+
+int main( int argc, char *argv[] )
+{
+    static double v[BATCH];
+    RunQuantile *r[MAX_QUANTILES];
+    double q[MAX_QUANTILES];
+    const char *fname = "-";
+    FILE *filein = stdin;
+    ValReader *reader;
+    long every = 0, next;
+    int nq = 0, a = 1, n, i, j, step;
+
+    while (a+1 < argc && (strcmp(argv[a], "-q") == 0 || strcmp(argv[a], "-e") == 0)) {
+        if (strcmp(argv[a], "-e") == 0) {
+            every = atol(argv[a+1]);
+        } else if (nq < MAX_QUANTILES) {
+            q[nq++] = atof(argv[a+1]);
+        } else {
+            break;
+        }
+        a += 2;
+    }
+    if (a < argc) {
+        fname = argv[a];
+        a++;
+    }
+    if (nq == 0) {
+        q[nq++] = 0.5;
+    }
+    for (j=0; j<nq && q[j] >= 0.0 && q[j] <= 1.0; j++)
+        ;
+    if (a != argc || j < nq || every < 0) {
+        fprintf(stderr, "Usage: %s [-q q]... [-e every] [inputfile]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(fname, "-") != 0) {
+        filein = fopen(fname, "r");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", fname);
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (j=0; j<nq; j++) {
+        r[j] = runquantile_create(q[j]);
+    }
+    next = every;
+    reader = valreader_create(filein);
+    while ((n = valreader_read(reader, v, BATCH)) > 0) {
+        /* i valori vengono aggiunti a blocchi che terminano nei punti
+           in cui bisogna stampare i quantili */
+        for (i=0; i<n; i+=step) {
+            step = n - i;
+            if (every > 0 && runquantile_get_n(r[0]) + step > next)
+                step = (int)(next - runquantile_get_n(r[0]));
+            for (j=0; j<nq; j++) {
+                runquantile_add_batch(r[j], v + i, step);
+            }
+            if (every > 0 && runquantile_get_n(r[0]) == next) {
+                print_quantiles(r, nq);
+                next += every;
+            }
+        }
+    }
+    valreader_destroy(reader);
+    if (filein != stdin) fclose(filein);
+    if (n < 0) {
+        fprintf(stderr, "%s: invalid value after %d values\n", fname, runquantile_get_n(r[0]));
+    } else if (runquantile_get_n(r[0]) > 0 && runquantile_get_n(r[0]) != next - every) {
+        /* l'ultima riga non è già stata stampata */
+        print_quantiles(r, nq);
+    }
+
+    for (j=0; j<nq; j++) {
+        runquantile_destroy(r[j]);
+    }
+    return (n < 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+}
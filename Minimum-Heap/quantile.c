@@ -0,0 +1,193 @@
+/****************************************************************************
+ *
+ * quantile.c -- Mediana e percentili di una sequenza
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Mediana e percentili di una sequenza
+% Ultimo aggiornamento: 2026-10-19
+
+Per mantenere la mediana (o un altro quantile) di una sequenza di
+valori che vengono ricevuti uno alla volta, i valori ricevuti finora
+sono divisi in due parti:
+
+- `low` contiene i `rank` valori minori, dove `rank` = $\lceil q n
+  \rceil$ (almeno 1) è il rango del quantile $q$; è un max-heap, per
+  cui il suo massimo, che è proprio il quantile, è accessibile in
+  tempo $O(1)$;
+
+- `high` contiene i valori rimanenti, ed è un min-heap.
+
+Quando arriva un nuovo valore $v$, `rank` aumenta di uno oppure
+resta invariato, per cui esattamente uno dei due heap deve crescere
+di un elemento. Se deve crescere `low`, vi si inserisce $v$ se non
+supera il minimo di `high`; altrimenti il minimo di `high` viene
+spostato in `low`, e il suo posto in `high` è preso da $v$ con
+`minheap_change_prio()`, cioè con un'unica discesa nello heap anziché
+un'estrazione seguita da un inserimento. Il caso in cui deve crescere
+`high` è simmetrico. Il costo di ogni inserimento è quindi $O(\log
+n)$.
+
+Entrambi gli heap sono `MinHeap`: `low` memorizza le priorità
+cambiate di segno. La chiave di ogni valore è la sua posizione nella
+sequenza, per cui le chiavi sono distinte in entrambi gli heap e un
+valore può essere spostato dall'uno all'altro senza cambiare chiave.
+Poiché la lunghezza della sequenza non è nota, quando gli heap sono
+pieni vengono sostituiti da heap di capienza doppia, in cui il
+contenuto viene trasferito con `minheap_meld()` in tempo lineare; il
+costo ammortizzato per valore resta $O(\log n)$.
+
+A differenza della selezione dei $k$ valori massimi
+([topk.c](topk.c)), la memoria richiesta è proporzionale al numero
+di valori ricevuti.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread minheap.c valreader.c quantile.c quantile-main.c -o quantile-main
+
+## File
+
+- [quantile.c](quantile.c)
+- [quantile.h](quantile.h)
+- [quantile-main.c](quantile-main.c)
+- [stream-bench.c](stream-bench.c)
+
+***/
+
+#include <stdlib.h>
+#include <limits.h>
+#include <assert.h>
+#include "quantile.h"
+
+RunQuantile *runquantile_create(double q)
+{
+    RunQuantile *r = (RunQuantile*)malloc(sizeof(*r));
+
+    assert(r != NULL);
+    assert(q >= 0.0 && q <= 1.0);
+
+    r->size = QUANTILE_INIT_SIZE;
+    r->low = minheap_create(r->size);
+    r->high = minheap_create(r->size);
+    r->q = q;
+    r->n = 0;
+    return r;
+}
+
+void runquantile_destroy(RunQuantile *r)
+{
+    assert(r != NULL);
+
+    minheap_destroy(r->low);
+    minheap_destroy(r->high);
+    free(r);
+}
+
+/* Funzione di supporto: restituisce uno heap di capienza `size` con
+   lo stesso contenuto di `h`, che viene deallocato */
+static MinHeap *grow(MinHeap *h, int size)
+{
+    MinHeap *result = minheap_create(size);
+
+    minheap_meld(result, h);
+    minheap_destroy(h);
+    return result;
+}
+
+/* Funzione di supporto: restituisce il rango del quantile quando
+   sono stati ricevuti n valori */
+static int quantile_rank(double q, int n)
+{
+    int rank = (int)(q * n);
+
+    if (rank < q * n)
+        rank++;
+    return (rank > 0 ? rank : 1);
+}
+
+void runquantile_add(RunQuantile *r, double v)
+{
+    MinHeap *low, *high;
+    int key;
+    double p;
+
+    assert(r != NULL);
+
+    if (v != v) {
+        return; /* NaN */
+    }
+    if (r->n == r->size) {
+        assert(r->size <= INT_MAX / 2);
+        r->size *= 2;
+        r->low = grow(r->low, r->size);
+        r->high = grow(r->high, r->size);
+    }
+    low = r->low;
+    high = r->high;
+    if (minheap_get_n(low) < quantile_rank(r->q, r->n + 1)) {
+        /* low deve crescere: riceve v oppure il minimo di high, che
+           viene sostituito da v */
+        if (minheap_is_empty(high) || v <= minheap_min_prio(high)) {
+            minheap_insert(low, r->n, -v);
+        } else {
+            key = minheap_min(high);
+            p = minheap_min_prio(high);
+            minheap_change_prio(high, key, v);
+            minheap_insert(low, r->n, -p);
+        }
+    } else {
+        /* high deve crescere: riceve v oppure il massimo di low, che
+           viene sostituito da v */
+        if (v >= -minheap_min_prio(low)) {
+            minheap_insert(high, r->n, v);
+        } else {
+            key = minheap_min(low);
+            p = -minheap_min_prio(low);
+            minheap_change_prio(low, key, -v);
+            minheap_insert(high, r->n, p);
+        }
+    }
+    r->n++;
+}
+
+void runquantile_add_batch(RunQuantile *r, const double *v, int n)
+{
+    int i;
+
+    assert(n >= 0);
+
+    for (i=0; i<n; i++) {
+        runquantile_add(r, v[i]);
+    }
+}
+
+double runquantile_get(const RunQuantile *r)
+{
+    assert(r != NULL);
+    assert(r->n > 0);
+
+    return -minheap_min_prio(r->low);
+}
+
+int runquantile_get_n(const RunQuantile *r)
+{
+    assert(r != NULL);
+
+    return r->n;
+}
@@ -0,0 +1,66 @@
+/****************************************************************************
+ *
+ * quantile.h -- Interfaccia mediana e percentili di una sequenza
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef QUANTILE_H
+#define QUANTILE_H
+
+#include "minheap.h"
+
+/* Capienza iniziale dei due heap; viene raddoppiata quando serve */
+#define QUANTILE_INIT_SIZE 1024
+
+typedef struct {
+    MinHeap *low; /* i `rank` valori minori, con priorità cambiata di segno */
+    MinHeap *high; /* i valori rimanenti */
+    double q; /* quantile da calcolare (0.5 = mediana) */
+    int n; /* numero di valori ricevuti, e prossima chiave libera */
+    int size; /* capienza di ciascuno heap */
+} RunQuantile;
+
+/* Crea un oggetto che mantiene il quantile `q` dei valori ricevuti;
+   ad esempio q = 0.5 per la mediana, q = 0.99 per il 99-esimo
+   percentile.
+
+   Precondizione: 0 <= q <= 1 */
+RunQuantile *runquantile_create(double q);
+
+/* Dealloca l'oggetto */
+void runquantile_destroy(RunQuantile *r);
+
+/* Aggiunge il valore `v`; i valori NaN vengono ignorati. Costo
+   O(log n) ammortizzato. */
+void runquantile_add(RunQuantile *r, double v);
+
+/* Aggiunge i valori v[0..n-1] */
+void runquantile_add_batch(RunQuantile *r, const double *v, int n);
+
+/* Restituisce il quantile `q` dei valori ricevuti finora, secondo il
+   metodo "nearest rank": il valore di rango ceil(q*n) (almeno 1)
+   nell'ordinamento non decrescente dei valori. Per q = 0.5 si
+   ottiene la mediana inferiore. Costo O(1).
+
+   Precondizione: è stato ricevuto almeno un valore */
+double runquantile_get(const RunQuantile *r);
+
+/* Restituisce il numero di valori ricevuti */
+int runquantile_get_n(const RunQuantile *r);
+
+#endif
@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ * radixheap-main.c -- Test del Radix Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include "radixheap.h"
+
+int main( int argc, char *argv[] )
+{
+    char op;
+    int n, key;
+    uint64_t prio;
+    RadixHeap *h;
+    FILE *filein = stdin;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s inputfile\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "-") != 0) {
+        filein = fopen(argv[1], "r");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (1 != fscanf(filein, "%d", &n)) {
+        fprintf(stderr, "Missing size\n");
+        return EXIT_FAILURE;
+    }
+    printf("radixheap_create(%d)\n", n);
+    h = radixheap_create(n);
+
+    while (1 == fscanf(filein, " %c", &op)) {
+        switch (op) {
+        case '+': /* insert */
+            fscanf(filein, "%d %" SCNu64, &key, &prio);
+            printf("radixheap_insert(h, %d, %" PRIu64 ")\n", key, prio);
+            radixheap_insert(h, key, prio);
+            break;
+        case '-': /* delete min */
+            key = radixheap_delete_min(h);
+            printf("radixheap_delete_min(h) = %d\n", key);
+            break;
+        case '?': /* get min */
+            key = radixheap_min(h);
+            printf("radixheap_min(h) = %d\n", key);
+            break;
+        case 'c': /* change prio */
+            fscanf(filein, "%d %" SCNu64, &key, &prio);
+            printf("radixheap_change_prio(h, %d, %" PRIu64 ")\n", key, prio);
+            radixheap_change_prio(h, key, prio);
+            break;
+        case 'r': /* remove */
+            fscanf(filein, "%d", &key);
+            printf("radixheap_remove(h, %d)\n", key);
+            radixheap_remove(h, key);
+            break;
+        case 'k': /* contains */
+            fscanf(filein, "%d", &key);
+            printf("radixheap_contains(h, %d) = %d\n", key, radixheap_contains(h, key));
+            break;
+        case 's': /* get n of elements */
+            printf("radixheap_get_n(h) = %d\n", radixheap_get_n(h));
+            break;
+        case 'p': /* print */
+            radixheap_print(h);
+            break;
+        default:
+            printf("Unknown command %c\n", op);
+            return EXIT_FAILURE;
+        }
+    }
+
+    radixheap_destroy(h);
+    if (filein != stdin) fclose(filein);
+
+    return EXIT_SUCCESS;
+}
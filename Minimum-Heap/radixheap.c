@@ -0,0 +1,379 @@
+/****************************************************************************
+ *
+ * radixheap.c -- Radix Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Radix Heap
+% Ultimo aggiornamento: 2026-10-19
+
+In molte applicazioni, ad esempio nell'algoritmo di Dijkstra con pesi
+interi, le priorità sono interi e la sequenza delle priorità estratte
+è non decrescente: ogni nuova priorità è maggiore o uguale all'ultima
+estratta, che indichiamo con $\mathit{last}$. Un _radix heap_ sfrutta
+questa proprietà per evitare del tutto il confronto tra elementi.
+
+Le coppie (chiave, priorità) sono distribuite in 65 _bucket_: una
+coppia con priorità $x$ si trova nel bucket 0 se $x = \mathit{last}$,
+altrimenti nel bucket $b$ tale che il bit più significativo in cui
+$x$ e $\mathit{last}$ differiscono è il bit $b-1$. Le priorità nel
+bucket $b$ sono quindi minori di quelle nei bucket successivi.
+
+- L'inserimento e la modifica della priorità (che non può scendere
+  sotto $\mathit{last}$) richiedono tempo $O(1)$: basta calcolare il
+  bucket e, se diverso, spostare la coppia. Ogni bucket è un array
+  non ordinato, e la posizione di ogni chiave nel suo bucket è
+  memorizzata in `idx[]` (come `pos[]` in [minheap.c](minheap.c)).
+
+- Se il bucket 0 non è vuoto, il minimo è uno qualsiasi dei suoi
+  elementi. Altrimenti si individua il primo bucket $b$ non vuoto e
+  il suo minimo $m$, si pone $\mathit{last} = m$ e si ridistribuiscono
+  gli elementi del bucket $b$. Rispetto al nuovo valore di
+  $\mathit{last}$, tutti finiscono in bucket di indice minore di $b$
+  (e almeno uno nel bucket 0).
+
+Poiché ogni coppia può solo scendere di bucket, il numero complessivo
+di spostamenti di una coppia è al più 65: il costo ammortizzato di
+`radixheap_delete_min()` è $O(\log C)$, dove $C$ è il massimo valore
+delle priorità. Tutte le operazioni scandiscono gli array dei bucket
+in modo sequenziale, con un ottimo uso della cache.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic radixheap.c radixheap-main.c -o radixheap-main
+
+Per eseguire:
+
+        ./radixheap-main inputfile
+
+dove `inputfile` contiene i comandi `+`, `-`, `?`, `c`, `r`, `k`, `s`
+e `p` di [minheap-main.c](minheap-main.c), con priorità intere non
+negative.
+
+## File
+
+- [radixheap.c](radixheap.c)
+- [radixheap.h](radixheap.h)
+- [radixheap-main.c](radixheap-main.c)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <inttypes.h>
+#include "radixheap.h"
+
+/* Funzione di supporto: restituisce il bucket in cui va inserita la
+   priorità x, cioè 0 se x == last, altrimenti uno più l'indice del
+   bit più significativo in cui x e last differiscono */
+static int bucket_index(uint64_t x, uint64_t last)
+{
+    uint64_t d = x ^ last;
+    int b = 0;
+
+    if (d >> 32) {
+        d >>= 32;
+        b += 32;
+    }
+    if (d >> 16) {
+        d >>= 16;
+        b += 16;
+    }
+    if (d >> 8) {
+        d >>= 8;
+        b += 8;
+    }
+    if (d >> 4) {
+        d >>= 4;
+        b += 4;
+    }
+    if (d >> 2) {
+        d >>= 2;
+        b += 2;
+    }
+    if (d >> 1) {
+        d >>= 1;
+        b += 1;
+    }
+    return b + (int)d;
+}
+
+/* Funzione di supporto: aggiunge la coppia (key, prio) al bucket b */
+static void bucket_push(RadixHeap *h, int b, int key, uint64_t prio)
+{
+    RadixBucket *bk = &(h->bucket[b]);
+
+    if (bk->n == bk->capacity) {
+        bk->capacity = (bk->capacity > 0 ? 2 * bk->capacity : 16);
+        bk->elem = (RadixElem*)realloc(bk->elem, bk->capacity * sizeof(*(bk->elem)));
+        assert(bk->elem != NULL);
+    }
+    bk->elem[bk->n].prio = prio;
+    bk->elem[bk->n].key = key;
+    h->bucket_of[key] = (signed char)b;
+    h->idx[key] = bk->n;
+    bk->n++;
+}
+
+/* Funzione di supporto: toglie la chiave `key` dal suo bucket,
+   spostando al suo posto l'ultimo elemento del bucket */
+static void bucket_erase(RadixHeap *h, int key)
+{
+    RadixBucket *bk = &(h->bucket[(int)h->bucket_of[key]]);
+    const int i = h->idx[key];
+
+    bk->n--;
+    if (i < bk->n) {
+        bk->elem[i] = bk->elem[bk->n];
+        h->idx[bk->elem[i].key] = i;
+    }
+    h->bucket_of[key] = -1;
+}
+
+RadixHeap *radixheap_create(int size)
+{
+    RadixHeap *h = (RadixHeap*)malloc(sizeof(*h));
+    int b, k;
+
+    assert(h != NULL);
+    assert(size > 0);
+
+    h->size = size;
+    h->n = 0;
+    h->last = 0;
+    for (b=0; b<RADIX_BUCKETS; b++) {
+        h->bucket[b].elem = NULL;
+        h->bucket[b].n = h->bucket[b].capacity = 0;
+    }
+    h->bucket_of = (signed char*)malloc(size * sizeof(*(h->bucket_of)));
+    h->idx = (int*)malloc(size * sizeof(*(h->idx)));
+    assert(h->bucket_of != NULL && h->idx != NULL);
+    for (k=0; k<size; k++) {
+        h->bucket_of[k] = -1;
+    }
+    return h;
+}
+
+void radixheap_clear(RadixHeap *h)
+{
+    int b, i;
+
+    assert(h != NULL);
+
+    for (b=0; b<RADIX_BUCKETS; b++) {
+        for (i=0; i<h->bucket[b].n; i++) {
+            h->bucket_of[h->bucket[b].elem[i].key] = -1;
+        }
+        h->bucket[b].n = 0;
+    }
+    h->n = 0;
+    h->last = 0;
+}
+
+void radixheap_destroy(RadixHeap *h)
+{
+    int b;
+
+    assert(h != NULL);
+
+    for (b=0; b<RADIX_BUCKETS; b++) {
+        free(h->bucket[b].elem);
+    }
+    free(h->bucket_of);
+    free(h->idx);
+    free(h);
+}
+
+int radixheap_is_empty(const RadixHeap *h)
+{
+    assert(h != NULL);
+
+    return (h->n == 0);
+}
+
+int radixheap_get_n(const RadixHeap *h)
+{
+    assert(h != NULL);
+
+    return h->n;
+}
+
+int radixheap_contains(const RadixHeap *h, int key)
+{
+    assert(h != NULL);
+
+    return (key >= 0) && (key < h->size) && (h->bucket_of[key] != -1);
+}
+
+uint64_t radixheap_get_prio(const RadixHeap *h, int key)
+{
+    assert(radixheap_contains(h, key));
+
+    return h->bucket[(int)h->bucket_of[key]].elem[h->idx[key]].prio;
+}
+
+/* Funzione di supporto, usata solo da radixheap_delete_min(): se il
+   bucket 0 è vuoto, aggiorna `last` al minimo del primo bucket non
+   vuoto e ne ridistribuisce gli elementi; al termine il bucket 0
+   contiene le coppie di priorità minima */
+static void refill(RadixHeap *h)
+{
+    RadixBucket *bk;
+    RadixElem *elem;
+    uint64_t m;
+    int b, i, cnt;
+
+    assert( !radixheap_is_empty(h) );
+
+    if (h->bucket[0].n > 0) {
+        return;
+    }
+    for (b=1; h->bucket[b].n == 0; b++)
+        ;
+    bk = &(h->bucket[b]);
+    m = bk->elem[0].prio;
+    for (i=1; i<bk->n; i++) {
+        if (bk->elem[i].prio < m) {
+            m = bk->elem[i].prio;
+        }
+    }
+    h->last = m;
+    /* Il bucket viene svuotato prima di ridistribuirne gli elementi;
+       bucket_push() non può reinserirli nel bucket b stesso */
+    elem = bk->elem;
+    cnt = bk->n;
+    bk->n = 0;
+    for (i=0; i<cnt; i++) {
+        const int nb = bucket_index(elem[i].prio, m);
+        assert(nb < b);
+        bucket_push(h, nb, elem[i].key, elem[i].prio);
+    }
+}
+
+/* Funzione di supporto: restituisce l'elemento di priorità minima,
+   che si trova nel primo bucket non vuoto. Non si può usare refill(),
+   che aggiornerebbe `last`: dopo aver letto il minimo si possono
+   ancora inserire priorità comprese tra l'ultima estratta e il
+   minimo. */
+static const RadixElem *find_min(const RadixHeap *h)
+{
+    const RadixBucket *bk;
+    int b, i, best = 0;
+
+    assert( !radixheap_is_empty(h) );
+
+    for (b=0; h->bucket[b].n == 0; b++)
+        ;
+    bk = &(h->bucket[b]);
+    if (b > 0) {
+        for (i=1; i<bk->n; i++) {
+            if (bk->elem[i].prio < bk->elem[best].prio) {
+                best = i;
+            }
+        }
+    }
+    return &(bk->elem[best]);
+}
+
+int radixheap_min(const RadixHeap *h)
+{
+    return find_min(h)->key;
+}
+
+uint64_t radixheap_min_prio(const RadixHeap *h)
+{
+    return find_min(h)->prio;
+}
+
+void radixheap_insert(RadixHeap *h, int key, uint64_t prio)
+{
+    assert(h != NULL);
+    assert((key >= 0) && (key < h->size));
+    assert( !radixheap_contains(h, key) );
+    assert(prio >= h->last);
+
+    bucket_push(h, bucket_index(prio, h->last), key, prio);
+    h->n++;
+}
+
+int radixheap_delete_min(RadixHeap *h)
+{
+    int key;
+
+    refill(h);
+    /* si rimuove proprio l'elemento restituito da radixheap_min():
+       refill() sposta le coppie nel bucket 0 nello stesso ordine in
+       cui si trovavano, per cui find_min() indica la stessa coppia
+       prima e dopo la ridistribuzione */
+    key = find_min(h)->key;
+    bucket_erase(h, key);
+    h->n--;
+    return key;
+}
+
+uint64_t radixheap_last(const RadixHeap *h)
+{
+    assert(h != NULL);
+
+    return h->last;
+}
+
+void radixheap_change_prio(RadixHeap *h, int key, uint64_t newprio)
+{
+    const int b = bucket_index(newprio, h->last);
+
+    assert(radixheap_contains(h, key));
+    assert(newprio >= h->last);
+
+    if (b == h->bucket_of[key]) {
+        h->bucket[b].elem[h->idx[key]].prio = newprio;
+    } else {
+        bucket_erase(h, key);
+        bucket_push(h, b, key, newprio);
+    }
+}
+
+void radixheap_remove(RadixHeap *h, int key)
+{
+    assert(radixheap_contains(h, key));
+
+    bucket_erase(h, key);
+    h->n--;
+}
+
+void radixheap_print(const RadixHeap *h)
+{
+    int b, i;
+
+    assert(h != NULL);
+
+    printf("\n** Contenuto dello heap:\n\n");
+    printf("n=%d size=%d last=%" PRIu64 "\n", h->n, h->size, h->last);
+    for (b=0; b<RADIX_BUCKETS; b++) {
+        if (h->bucket[b].n > 0) {
+            printf("bucket[%2d]:", b);
+            for (i=0; i<h->bucket[b].n; i++) {
+                printf(" (%d, %" PRIu64 ")", h->bucket[b].elem[i].key, h->bucket[b].elem[i].prio);
+            }
+            printf("\n");
+        }
+    }
+    printf("\n\n** Fine contenuto dello heap\n\n");
+}
@@ -0,0 +1,124 @@
+/****************************************************************************
+ *
+ * radixheap.h -- Interfaccia Radix Heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef RADIXHEAP_H
+#define RADIXHEAP_H
+
+#include <stdint.h>
+
+/* Numero di bucket: il bucket 0 contiene le priorità uguali
+   all'ultima estratta, il bucket b > 0 quelle il cui bit più
+   significativo diverso dall'ultima estratta è il bit b-1 */
+#define RADIX_BUCKETS 65
+
+typedef struct {
+    uint64_t prio;
+    int key;
+} RadixElem;
+
+typedef struct {
+    RadixElem *elem; /* elem[0..n-1] sono le coppie del bucket */
+    int n, capacity;
+} RadixBucket;
+
+typedef struct {
+    RadixBucket bucket[RADIX_BUCKETS];
+    uint64_t last; /* ultima priorità estratta (inizialmente 0) */
+    signed char *bucket_of; /* bucket_of[k] è il bucket della chiave k, -1 se assente */
+    int *idx; /* idx[k] è la posizione della chiave k nel suo bucket */
+    int n; /* numero di coppie (chiave, prio) presenti */
+    int size; /* le chiavi sono gli interi 0 .. size-1 */
+} RadixHeap;
+
+/* Crea un radix heap vuoto; le chiavi possono essere gli interi 0
+   .. `size` - 1, le priorità interi senza segno a 64 bit. Lo heap è
+   _monotono_: una priorità non può essere minore dell'ultima
+   priorità estratta (inizialmente 0).
+
+   Precondizione: size > 0 */
+RadixHeap *radixheap_create(int size);
+
+/* Svuota lo heap; l'ultima priorità estratta torna a 0 */
+void radixheap_clear(RadixHeap *h);
+
+/* Dealloca la memoria occupata dallo heap h e dal suo contenuto */
+void radixheap_destroy(RadixHeap *h);
+
+/* Restituisce 1 se e solo se lo heap è vuoto */
+int radixheap_is_empty(const RadixHeap *h);
+
+/* Ritorna il numero di elementi effettivamente presenti nello heap */
+int radixheap_get_n(const RadixHeap *h);
+
+/* Restituisce la chiave associata alla minima priorità; non modifica
+   lo heap. Se l'ultima coppia estratta aveva priorità diversa, la
+   chiave viene cercata in un bucket non ordinato: conviene quindi
+   chiamare direttamente `radixheap_delete_min()` quando possibile.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int radixheap_min(const RadixHeap *h);
+
+/* Restituisce la minima priorità; non modifica lo heap.
+
+   Precondizione: lo heap non deve essere vuoto. */
+uint64_t radixheap_min_prio(const RadixHeap *h);
+
+/* Inserisce una nuova chiave `key` con priorità `prio`.
+
+   Precondizioni:
+   - `key` deve essere una chiave valida e non presente nello heap;
+   - `prio` non deve essere minore dell'ultima priorità estratta. */
+void radixheap_insert(RadixHeap *h, int key, uint64_t prio);
+
+/* Rimuove dallo heap la coppia (chiave, prio) con priorità minima, e
+   restituisce la chiave di tale coppia.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int radixheap_delete_min(RadixHeap *h);
+
+/* Restituisce l'ultima priorità estratta (0 se non è ancora stata
+   estratta alcuna coppia) */
+uint64_t radixheap_last(const RadixHeap *h);
+
+/* Modifica la priorità associata alla chiave `key`; tempo O(1).
+
+   Precondizioni:
+   - la chiave `key` deve essere presente nello heap;
+   - `new_prio` non deve essere minore dell'ultima priorità estratta. */
+void radixheap_change_prio(RadixHeap *h, int key, uint64_t new_prio);
+
+/* Restituisce la priorità associata alla chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+uint64_t radixheap_get_prio(const RadixHeap *h, int key);
+
+/* Restituisce 1 se e solo se la chiave `key` è presente nello heap */
+int radixheap_contains(const RadixHeap *h, int key);
+
+/* Rimuove dallo heap la coppia (chiave, prio) di chiave `key`.
+
+   Precondizione: la chiave `key` deve essere presente nello heap. */
+void radixheap_remove(RadixHeap *h, int key);
+
+/* Stampa il contenuto dello heap */
+void radixheap_print(const RadixHeap *h);
+
+#endif
@@ -0,0 +1,177 @@
+/****************************************************************************
+ *
+ * seqheap-bench.c -- Confronto tra MinHeap e sequence heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Confronta MinHeap e il sequence heap (seqheap.c) su n inserimenti
+   seguiti da n estrazioni, con priorità casuali, e sul modello
+   "hold" con n elementi. Misura infine il sequence heap con le
+   sequenze più lunghe di `spill` coppie scritte su disco.
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 minheap.c seqheap.c seqheap-bench.c -o seqheap-bench
+
+   Per eseguire:
+
+        ./seqheap-bench [n [spill]]
+
+   dove `n` (default 10000000) è il numero di elementi e `spill`
+   (default n/16) la soglia usata per le sequenze su disco. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <assert.h>
+#include "minheap.h"
+#include "seqheap.h"
+
+/* Restituisce un valore reale casuale in [0, 1) */
+static double randunif( void )
+{
+    return rand() / ((double)RAND_MAX + 1);
+}
+
+static double elapsed_since(clock_t tstart)
+{
+    return ((double)(clock() - tstart)) / CLOCKS_PER_SEC;
+}
+
+static double drain_minheap(const double *prio, int n)
+{
+    clock_t tstart = clock();
+    MinHeap *h = minheap_create(n);
+    double last = -1.0;
+    int i;
+
+    for (i=0; i<n; i++) {
+        minheap_insert(h, i, prio[i]);
+    }
+    for (i=0; i<n; i++) {
+        const double p = minheap_min_prio(h);
+        assert(p >= last);
+        last = p;
+        minheap_delete_min(h);
+    }
+    minheap_destroy(h);
+    return elapsed_since(tstart);
+}
+
+static double drain_seqheap(const double *prio, int n, long spill)
+{
+    clock_t tstart = clock();
+    SeqHeap *h = seqheap_create(spill);
+    double last = -1.0;
+    int i;
+
+    for (i=0; i<n; i++) {
+        seqheap_insert(h, i, prio[i]);
+    }
+    for (i=0; i<n; i++) {
+        const double p = seqheap_min_prio(h);
+        if (seqheap_error(h))
+            break;
+        assert(p >= last);
+        last = p;
+        seqheap_delete_min(h);
+    }
+    if (seqheap_error(h)) {
+        printf("(I/O error on temporary files) ");
+    } else if (spill > 0) {
+        printf("(%ld runs written to disk) ", h->nspilled);
+    }
+    seqheap_destroy(h);
+    return elapsed_since(tstart);
+}
+
+/* Modello "hold" con n elementi e n operazioni di estrazione e
+   reinserimento */
+static double hold_minheap(const double *prio, int n)
+{
+    clock_t tstart = clock();
+    MinHeap *h = minheap_create(n);
+    int i, key;
+
+    for (i=0; i<n; i++) {
+        minheap_insert(h, i, prio[i]);
+    }
+    for (i=0; i<n; i++) {
+        const double now = minheap_min_prio(h);
+        key = minheap_delete_min(h);
+        minheap_insert(h, key, now + prio[i]);
+    }
+    minheap_destroy(h);
+    return elapsed_since(tstart);
+}
+
+static double hold_seqheap(const double *prio, int n)
+{
+    clock_t tstart = clock();
+    SeqHeap *h = seqheap_create(0);
+    int i, key;
+
+    for (i=0; i<n; i++) {
+        seqheap_insert(h, i, prio[i]);
+    }
+    for (i=0; i<n; i++) {
+        const double now = seqheap_min_prio(h);
+        key = seqheap_delete_min(h);
+        seqheap_insert(h, key, now + prio[i]);
+    }
+    seqheap_destroy(h);
+    return elapsed_since(tstart);
+}
+
+int main( int argc, char *argv[] )
+{
+    int n = 10000000, i;
+    long spill;
+    double *prio;
+
+    if (argc > 3) {
+        fprintf(stderr, "Usage: %s [n [spill]]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 1) {
+        n = atoi(argv[1]);
+    }
+    spill = (argc > 2 ? atol(argv[2]) : n / 16);
+    if (n < 1) {
+        fprintf(stderr, "Invalid size\n");
+        return EXIT_FAILURE;
+    }
+
+    prio = (double*)malloc(n * sizeof(*prio));
+    assert(prio != NULL);
+    srand(42);
+    for (i=0; i<n; i++) {
+        prio[i] = randunif();
+    }
+
+    printf("n=%d\n", n);
+    printf("insert + delete_min, MinHeap  %f seconds\n", drain_minheap(prio, n));
+    printf("insert + delete_min, SeqHeap  %f seconds\n", drain_seqheap(prio, n, 0));
+    printf("hold, MinHeap                 %f seconds\n", hold_minheap(prio, n));
+    printf("hold, SeqHeap                 %f seconds\n", hold_seqheap(prio, n));
+    printf("insert + delete_min, SeqHeap, spill=%ld ", spill);
+    printf("%f seconds\n", drain_seqheap(prio, n, spill));
+
+    free(prio);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,88 @@
+/****************************************************************************
+ *
+ * seqheap-main.c -- Programma di test per il sequence heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "seqheap.h"
+
+int main( int argc, char *argv[] )
+{
+    char op;
+    int key;
+    long spill;
+    double prio;
+    SeqHeap *h;
+    FILE *filein = stdin;
+
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s inputfile\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "-") != 0) {
+        filein = fopen(argv[1], "r");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", argv[1]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (1 != fscanf(filein, "%ld", &spill)) {
+        fprintf(stderr, "Missing spill threshold\n");
+        return EXIT_FAILURE;
+    }
+    printf("seqheap_create(%ld)\n", spill);
+    h = seqheap_create(spill);
+
+    while (1 == fscanf(filein, " %c", &op)) {
+        switch (op) {
+        case '+': /* insert */
+            fscanf(filein, "%d %lf", &key, &prio);
+            printf("seqheap_insert(h, %d, %f)\n", key, prio);
+            seqheap_insert(h, key, prio);
+            break;
+        case '-': /* delete min */
+            key = seqheap_delete_min(h);
+            printf("seqheap_delete_min(h) = %d\n", key);
+            break;
+        case '?': /* get min */
+            key = seqheap_min(h);
+            printf("seqheap_min(h) = %d\n", key);
+            break;
+        case 's': /* get n of elements */
+            printf("seqheap_get_n(h) = %ld\n", seqheap_get_n(h));
+            break;
+        default:
+            printf("Unknown command %c\n", op);
+            return EXIT_FAILURE;
+        }
+        if (seqheap_error(h)) {
+            fprintf(stderr, "I/O error on temporary file\n");
+            return EXIT_FAILURE;
+        }
+    }
+
+    seqheap_destroy(h);
+    if (filein != stdin) fclose(filein);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,519 @@
+/****************************************************************************
+ *
+ * seqheap.c -- Sequence heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Sequence heap
+% Ultimo aggiornamento: 2026-10-19
+
+Quando uno heap binario contiene decine di milioni di elementi, ogni
+livello visitato da `move_down()` richiede quasi sempre un accesso
+alla memoria principale, perché i nodi di un cammino radice-foglia
+sono lontani tra loro. Il _sequence heap_ (P. Sanders, _Fast priority
+queues for cached memory_, 2000) organizza invece gli elementi in
+modo che quasi tutti gli accessi siano sequenziali.
+
+La struttura è formata da:
+
+- uno _heap di inserimento_ di capacità `SEQHEAP_INS` (1024 coppie,
+  16 KB), abbastanza piccolo da risiedere nella cache. I nuovi
+  elementi vengono inseriti qui; quando lo heap è pieno, il suo
+  contenuto viene ordinato e diventa una nuova _sequenza_ (run)
+  ordinata;
+
+- fino a `SEQHEAP_GROUPS` _gruppi_, ciascuno con al più `SEQHEAP_K`
+  sequenze ordinate, fuse da un _albero dei perdenti_ (loser tree)
+  con `SEQHEAP_K` foglie. Le nuove sequenze entrano nel gruppo 0;
+  quando il gruppo $g$ è pieno, tutte le sue sequenze vengono fuse
+  in un'unica sequenza, che entra nel gruppo $g+1$. Le sequenze del
+  gruppo $g$ sono quindi lunghe circa $\mathtt{SEQHEAP\_INS} \cdot
+  \mathtt{SEQHEAP\_K}^g$;
+
+- un _buffer di cancellazione_ che contiene, ordinate, le
+  `SEQHEAP_DEL` coppie minime tra quelle di tutti i gruppi.
+
+Il minimo si trova quindi nello heap di inserimento oppure
+all'inizio del buffer di cancellazione; quando quest'ultimo si
+svuota, viene riempito estraendo coppie dagli alberi dei perdenti (in
+ciascun albero, estrarre una coppia richiede un confronto per livello
+tra la foglia vincitrice e la radice, senza accedere alle altre
+foglie). Quando lo heap di inserimento viene svuotato, il contenuto
+del buffer di cancellazione viene fuso con la nuova sequenza, in modo
+che il buffer contenga sempre le coppie minime dei gruppi.
+
+Rispetto alla versione di Sanders, in cui anche ogni gruppo ha un
+proprio buffer, questa implementazione è semplificata: il buffer di
+cancellazione viene riempito confrontando direttamente i vincitori
+dei gruppi, che sono pochi.
+
+Le sequenze che si ottengono fondendo un gruppo possono essere
+scritte su disco, in file temporanei: poiché vengono sempre lette
+dall'inizio alla fine, basta tenerne in memoria un buffer di
+`SEQHEAP_IOBUF` coppie ciascuna. In questo modo la coda può contenere
+molte più coppie di quante ne possa contenere la memoria.
+
+Le operazioni sui file temporanei possono fallire (ad esempio perché
+il disco è pieno). Se non è possibile creare il file, la sequenza
+resta in memoria; se invece la scrittura o la lettura falliscono, le
+coppie che non è stato possibile scrivere o leggere vengono scartate,
+e il contatore delle coppie presenti viene aggiornato di conseguenza.
+In tutti i casi lo heap rimane utilizzabile, e `seqheap_error()`
+segnala al chiamante che si è verificato un errore.
+
+## File
+
+- [seqheap.c](seqheap.c)
+- [seqheap.h](seqheap.h)
+- [seqheap-main.c](seqheap-main.c)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include "seqheap.h"
+
+/* Funzione di supporto: legge dal file della sequenza `r` dello
+   heap `h` le prossime coppie. Se la lettura fallisce, la sequenza
+   termina con le coppie lette e le rimanenti vengono scartate. */
+static void run_fill(SeqHeap *h, SeqRun *r)
+{
+    size_t nread;
+
+    r->nbuf = (r->left < SEQHEAP_IOBUF ? (int)r->left : SEQHEAP_IOBUF);
+    r->pos = 0;
+    nread = fread(r->buf, sizeof(*(r->buf)), r->nbuf, r->f);
+    if (nread != (size_t)r->nbuf) {
+        h->err = 1;
+        h->n -= r->left - (long)nread;
+        r->nbuf = (int)nread;
+        r->left = (long)nread;
+    }
+}
+
+/* Funzione di supporto: avanza alla coppia successiva della sequenza
+   `r` dello heap `h`; la sequenza non deve essere esaurita */
+static void run_advance(SeqHeap *h, SeqRun *r)
+{
+    r->pos++;
+    r->left--;
+    if (r->pos == r->nbuf && r->left > 0) {
+        assert(r->f != NULL);
+        run_fill(h, r);
+    }
+}
+
+static void run_free(SeqRun *r)
+{
+    free(r->buf);
+    if (r->f != NULL) {
+        fclose(r->f);
+    }
+    r->buf = NULL;
+    r->f = NULL;
+    r->left = 0;
+}
+
+/* Funzione di supporto: restituisce 1 se e solo se la prossima
+   coppia della sequenza `a` del gruppo `g` precede quella della
+   sequenza `b`; le sequenze esaurite (e quelle non usate) seguono
+   tutte le altre */
+static int run_less(const SeqGroup *g, int a, int b)
+{
+    const SeqRun *ra = &g->run[a], *rb = &g->run[b];
+
+    if (ra->left == 0)
+        return 0;
+    if (rb->left == 0)
+        return 1;
+    return ra->buf[ra->pos].prio < rb->buf[rb->pos].prio;
+}
+
+/* Funzione di supporto: costruisce l'albero dei perdenti del gruppo
+   `g`. I nodi interni sono 1 .. SEQHEAP_K-1, con figli 2i e 2i+1; la
+   foglia della sequenza s è il nodo SEQHEAP_K + s. */
+static void group_build(SeqGroup *g)
+{
+    int winner[2*SEQHEAP_K];
+    int i;
+
+    for (i=0; i<SEQHEAP_K; i++) {
+        winner[SEQHEAP_K + i] = i;
+    }
+    for (i=SEQHEAP_K-1; i>=1; i--) {
+        const int a = winner[2*i], b = winner[2*i+1];
+        if (run_less(g, b, a)) {
+            winner[i] = b;
+            g->tree[i] = a;
+        } else {
+            winner[i] = a;
+            g->tree[i] = b;
+        }
+    }
+    g->tree[0] = winner[1];
+}
+
+/* Funzione di supporto: restituisce 1 se e solo se il gruppo `g`
+   contiene almeno una coppia */
+static int group_nonempty(const SeqGroup *g)
+{
+    return g->nruns > 0 && g->run[g->tree[0]].left > 0;
+}
+
+/* Funzione di supporto: estrae la coppia minima del gruppo `g` dello
+   heap `h`, che non deve essere vuoto, e aggiorna l'albero dei
+   perdenti lungo il cammino dalla foglia vincitrice alla radice */
+static SeqElem group_pop(SeqHeap *h, SeqGroup *g)
+{
+    int winner = g->tree[0], node, tmp;
+    SeqRun *r = &g->run[winner];
+    const SeqElem e = r->buf[r->pos];
+
+    run_advance(h, r);
+    for (node = (SEQHEAP_K + winner) / 2; node >= 1; node /= 2) {
+        if (run_less(g, g->tree[node], winner)) {
+            tmp = g->tree[node];
+            g->tree[node] = winner;
+            winner = tmp;
+        }
+    }
+    g->tree[0] = winner;
+    return e;
+}
+
+/* Funzione di supporto: fonde tutte le sequenze del gruppo `gi`,
+   che rimane vuoto, e restituisce la sequenza risultante. La
+   sequenza viene scritta su disco se è più lunga di h->spill; se
+   non è possibile creare il file temporaneo resta in memoria, mentre
+   le coppie che non è possibile scrivere vengono scartate. */
+static SeqRun group_merge(SeqHeap *h, int gi)
+{
+    SeqGroup *g = &h->group[gi];
+    SeqRun out;
+    long total = 0, written = 0, i;
+    int s, nout = 0;
+
+    for (s=0; s<g->nruns; s++) {
+        total += g->run[s].left;
+    }
+    out.pos = 0;
+    out.f = NULL;
+    if (h->spill > 0 && total > h->spill) {
+        out.f = tmpfile();
+        if (out.f == NULL) {
+            h->err = 1;
+        }
+    }
+    if (out.f != NULL) {
+        int ok = 1;
+        out.buf = (SeqElem*)malloc(SEQHEAP_IOBUF * sizeof(*(out.buf)));
+        assert(out.buf != NULL);
+        /* la lettura di una sequenza del gruppo può fallire, per cui
+           il gruppo può esaurirsi prima di aver estratto `total`
+           coppie */
+        for (i=0; i<total && group_nonempty(g); i++) {
+            out.buf[nout++] = group_pop(h, g);
+            if (nout == SEQHEAP_IOBUF || i == total-1 || !group_nonempty(g)) {
+                /* dopo il primo errore si continua a svuotare il
+                   gruppo, scartando le coppie estratte */
+                ok = ok && (fwrite(out.buf, sizeof(*(out.buf)), nout, out.f) == (size_t)nout);
+                if (ok) {
+                    written += nout;
+                }
+                nout = 0;
+            }
+        }
+        /* se fflush() fallisce non si sa quali coppie siano state
+           effettivamente scritte, per cui si scartano tutte */
+        if (fflush(out.f) != 0) {
+            written = 0;
+            ok = 0;
+        }
+        if (!ok) {
+            h->err = 1;
+            h->n -= i - written;
+        }
+        rewind(out.f);
+        out.left = written;
+        run_fill(h, &out);
+        h->nspilled++;
+    } else {
+        out.buf = (SeqElem*)malloc((total > 0 ? total : 1) * sizeof(*(out.buf)));
+        assert(out.buf != NULL);
+        for (i=0; i<total && group_nonempty(g); i++) {
+            out.buf[i] = group_pop(h, g);
+        }
+        out.nbuf = (int)i;
+        out.left = i;
+    }
+    for (s=0; s<g->nruns; s++) {
+        run_free(&g->run[s]);
+    }
+    g->nruns = 0;
+    group_build(g);
+    return out;
+}
+
+/* Funzione di supporto: aggiunge la sequenza `r` al gruppo `gi`; se
+   il gruppo è pieno, le sue sequenze vengono prima fuse e spostate
+   nel gruppo successivo */
+static void group_add(SeqHeap *h, int gi, SeqRun r)
+{
+    SeqGroup *g = &h->group[gi];
+    int s, t = 0;
+
+    assert(gi < SEQHEAP_GROUPS);
+
+    /* eliminazione delle sequenze esaurite */
+    for (s=0; s<g->nruns; s++) {
+        if (g->run[s].left > 0) {
+            g->run[t++] = g->run[s];
+        } else {
+            run_free(&g->run[s]);
+        }
+    }
+    for (s=t; s<g->nruns; s++) {
+        g->run[s].buf = NULL;
+        g->run[s].f = NULL;
+        g->run[s].left = 0;
+    }
+    g->nruns = t;
+
+    if (g->nruns == SEQHEAP_K) {
+        group_add(h, gi+1, group_merge(h, gi));
+    }
+    g->run[g->nruns++] = r;
+    group_build(g);
+    if (gi >= h->ngroups) {
+        h->ngroups = gi+1;
+    }
+}
+
+static int compare_prio(const void *a, const void *b)
+{
+    const double pa = ((const SeqElem*)a)->prio, pb = ((const SeqElem*)b)->prio;
+
+    return (pa > pb) - (pa < pb);
+}
+
+/* Funzione di supporto: ordina il contenuto dello heap di
+   inserimento, lo fonde con il buffer di cancellazione e aggiunge la
+   sequenza risultante al gruppo 0 */
+static void flush_ins(SeqHeap *h)
+{
+    SeqRun r;
+    int i = 0, j = h->dpos, k = 0;
+
+    qsort(h->ins, h->nins, sizeof(*(h->ins)), compare_prio);
+    r.f = NULL;
+    r.pos = 0;
+    r.nbuf = h->nins + h->ndel - h->dpos;
+    r.left = r.nbuf;
+    r.buf = (SeqElem*)malloc(r.nbuf * sizeof(*(r.buf)));
+    assert(r.buf != NULL);
+    while (i < h->nins && j < h->ndel) {
+        if (h->del[j].prio < h->ins[i].prio) {
+            r.buf[k++] = h->del[j++];
+        } else {
+            r.buf[k++] = h->ins[i++];
+        }
+    }
+    while (i < h->nins) {
+        r.buf[k++] = h->ins[i++];
+    }
+    while (j < h->ndel) {
+        r.buf[k++] = h->del[j++];
+    }
+    h->nins = 0;
+    h->dpos = h->ndel = 0;
+    group_add(h, 0, r);
+}
+
+/* Funzione di supporto: se il buffer di cancellazione è vuoto, lo
+   riempie con le coppie minime dei gruppi */
+static void fill_del(SeqHeap *h)
+{
+    const SeqElem *top, *best_top = NULL;
+    int g, best;
+
+    if (h->dpos < h->ndel)
+        return;
+    h->dpos = h->ndel = 0;
+    while (h->ndel < SEQHEAP_DEL) {
+        best = -1;
+        for (g=0; g<h->ngroups; g++) {
+            const SeqGroup *gr = &h->group[g];
+            if (group_nonempty(gr)) {
+                top = &gr->run[gr->tree[0]].buf[gr->run[gr->tree[0]].pos];
+                if (best < 0 || top->prio < best_top->prio) {
+                    best = g;
+                    best_top = top;
+                }
+            }
+        }
+        if (best < 0)
+            break;
+        h->del[h->ndel++] = group_pop(h, &h->group[best]);
+    }
+}
+
+SeqHeap *seqheap_create(long spill)
+{
+    SeqHeap *h = (SeqHeap*)malloc(sizeof(*h));
+    int g, s;
+
+    assert(h != NULL);
+
+    h->nins = 0;
+    h->dpos = h->ndel = 0;
+    for (g=0; g<SEQHEAP_GROUPS; g++) {
+        for (s=0; s<SEQHEAP_K; s++) {
+            h->group[g].run[s].buf = NULL;
+            h->group[g].run[s].f = NULL;
+            h->group[g].run[s].left = 0;
+        }
+        h->group[g].nruns = 0;
+        group_build(&h->group[g]);
+    }
+    h->ngroups = 0;
+    h->n = 0;
+    h->spill = spill;
+    h->nspilled = 0;
+    h->err = 0;
+    return h;
+}
+
+void seqheap_destroy(SeqHeap *h)
+{
+    int g, s;
+
+    assert(h != NULL);
+
+    for (g=0; g<h->ngroups; g++) {
+        for (s=0; s<h->group[g].nruns; s++) {
+            run_free(&h->group[g].run[s]);
+        }
+    }
+    free(h);
+}
+
+int seqheap_is_empty(const SeqHeap *h)
+{
+    assert(h != NULL);
+
+    return (h->n == 0);
+}
+
+long seqheap_get_n(const SeqHeap *h)
+{
+    assert(h != NULL);
+
+    return h->n;
+}
+
+int seqheap_error(const SeqHeap *h)
+{
+    assert(h != NULL);
+
+    return h->err;
+}
+
+/* Funzione di supporto: restituisce 1 se il minimo si trova nello
+   heap di inserimento, 0 se si trova nel buffer di cancellazione, -1
+   se lo heap si è svuotato perché la lettura di una sequenza su disco
+   è fallita */
+static int min_in_ins(SeqHeap *h)
+{
+    assert( !seqheap_is_empty(h) );
+
+    fill_del(h);
+    if (h->nins == 0 && h->dpos == h->ndel)
+        return -1;
+    return (h->nins > 0 && (h->dpos == h->ndel || h->ins[0].prio < h->del[h->dpos].prio));
+}
+
+int seqheap_min(SeqHeap *h)
+{
+    const int where = min_in_ins(h);
+
+    if (where < 0)
+        return -1;
+    return (where ? h->ins[0].key : h->del[h->dpos].key);
+}
+
+double seqheap_min_prio(SeqHeap *h)
+{
+    const int where = min_in_ins(h);
+
+    if (where < 0)
+        return HUGE_VAL;
+    return (where ? h->ins[0].prio : h->del[h->dpos].prio);
+}
+
+void seqheap_insert(SeqHeap *h, int key, double prio)
+{
+    int i, p;
+
+    assert(h != NULL);
+
+    if (h->nins == SEQHEAP_INS) {
+        flush_ins(h);
+    }
+    /* move_up() nello heap di inserimento */
+    i = h->nins++;
+    while (i > 0 && h->ins[p = (i-1)/2].prio > prio) {
+        h->ins[i] = h->ins[p];
+        i = p;
+    }
+    h->ins[i].key = key;
+    h->ins[i].prio = prio;
+    h->n++;
+}
+
+int seqheap_delete_min(SeqHeap *h)
+{
+    SeqElem last;
+    int key, i, c;
+    const int where = min_in_ins(h);
+
+    if (where < 0)
+        return -1;
+    if (where == 0) {
+        h->n--;
+        return h->del[h->dpos++].key;
+    }
+    /* move_down() nello heap di inserimento */
+    key = h->ins[0].key;
+    last = h->ins[--(h->nins)];
+    i = 0;
+    while ((c = 2*i+1) < h->nins) {
+        if (c+1 < h->nins && h->ins[c+1].prio < h->ins[c].prio)
+            c++;
+        if (h->ins[c].prio >= last.prio)
+            break;
+        h->ins[i] = h->ins[c];
+        i = c;
+    }
+    h->ins[i] = last;
+    h->n--;
+    return key;
+}
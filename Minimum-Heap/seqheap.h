@@ -0,0 +1,143 @@
+/****************************************************************************
+ *
+ * seqheap.h -- Interfaccia sequence heap
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef SEQHEAP_H
+#define SEQHEAP_H
+
+#include <stdio.h>
+
+/* Capacità dello heap di inserimento; può essere modificata in fase
+   di compilazione, come le costanti seguenti */
+#ifndef SEQHEAP_INS
+#define SEQHEAP_INS 1024
+#endif
+
+/* Numero massimo di sequenze (run) di ciascun gruppo, cioè numero di
+   foglie di ciascun albero dei perdenti */
+#ifndef SEQHEAP_K
+#define SEQHEAP_K 16
+#endif
+
+/* Capacità del buffer di cancellazione */
+#ifndef SEQHEAP_DEL
+#define SEQHEAP_DEL 256
+#endif
+
+/* Numero di coppie lette o scritte con una singola operazione sui
+   file delle sequenze su disco */
+#ifndef SEQHEAP_IOBUF
+#define SEQHEAP_IOBUF 4096
+#endif
+
+/* Numero massimo di gruppi: con i valori predefiniti, una coda può
+   contenere circa SEQHEAP_INS * SEQHEAP_K^SEQHEAP_GROUPS coppie */
+#define SEQHEAP_GROUPS 8
+
+typedef struct {
+    double prio;
+    int key;
+} SeqElem;
+
+/* Sequenza ordinata di coppie. Se `f` è NULL la sequenza è in
+   memoria, in buf[0..nbuf-1]; altrimenti si trova nel file `f`, e
+   buf[] contiene le prossime (al più SEQHEAP_IOBUF) coppie lette. */
+typedef struct {
+    SeqElem *buf;
+    int pos; /* buf[pos] è la prossima coppia della sequenza */
+    int nbuf; /* numero di coppie in buf[] */
+    long left; /* coppie ancora da estrarre, comprese quelle in buf[] */
+    FILE *f;
+} SeqRun;
+
+/* Gruppo di al più SEQHEAP_K sequenze, fuse da un albero dei
+   perdenti */
+typedef struct {
+    SeqRun run[SEQHEAP_K];
+    int nruns;
+    int tree[SEQHEAP_K]; /* tree[0] è la sequenza vincitrice, tree[1..] i perdenti */
+} SeqGroup;
+
+typedef struct {
+    SeqElem ins[SEQHEAP_INS]; /* heap di inserimento */
+    int nins;
+    SeqElem del[SEQHEAP_DEL]; /* buffer di cancellazione: del[dpos..ndel-1] */
+    int dpos, ndel;
+    SeqGroup group[SEQHEAP_GROUPS];
+    int ngroups;
+    long n; /* numero di coppie presenti */
+    long spill; /* sequenze più lunghe vanno su disco (0 = mai) */
+    long nspilled; /* numero di sequenze scritte su disco */
+    int err; /* 1 se un'operazione su un file temporaneo è fallita */
+} SeqHeap;
+
+/* Crea un sequence heap vuoto. Le sequenze prodotte dalla fusione di
+   un gruppo che contengono più di `spill` coppie vengono scritte in
+   file temporanei (creati con `tmpfile()`) anziché in memoria; se
+   spill <= 0 tutte le sequenze restano in memoria.
+
+   Se non è possibile creare un file temporaneo, la sequenza resta in
+   memoria. Se la scrittura o la lettura di un file temporaneo
+   falliscono, le coppie coinvolte vengono scartate (e non sono più
+   conteggiate da `seqheap_get_n()`); in entrambi i casi lo heap
+   rimane utilizzabile, ma `seqheap_error()` restituisce 1.
+
+   Le chiavi sono interi arbitrari, che possono anche ripetersi; non
+   sono previste operazioni che modificano o cercano una chiave. */
+SeqHeap *seqheap_create(long spill);
+
+/* Dealloca la memoria occupata dallo heap (e chiude i file
+   temporanei, che vengono cancellati) */
+void seqheap_destroy(SeqHeap *h);
+
+/* Restituisce 1 se e solo se lo heap è vuoto */
+int seqheap_is_empty(const SeqHeap *h);
+
+/* Restituisce il numero di coppie presenti */
+long seqheap_get_n(const SeqHeap *h);
+
+/* Restituisce 1 se un'operazione su uno dei file temporanei è
+   fallita, 0 altrimenti. Una volta impostato, l'indicatore di errore
+   non viene più azzerato. */
+int seqheap_error(const SeqHeap *h);
+
+/* Restituisce la chiave associata alla minima priorità. Restituisce
+   -1 se lo heap si svuota perché la lettura delle coppie da un file
+   temporaneo fallisce (si veda `seqheap_error()`).
+
+   Precondizione: lo heap non deve essere vuoto. */
+int seqheap_min(SeqHeap *h);
+
+/* Restituisce la minima priorità, oppure HUGE_VAL nello stesso caso
+   in cui `seqheap_min()` restituisce -1.
+
+   Precondizione: lo heap non deve essere vuoto. */
+double seqheap_min_prio(SeqHeap *h);
+
+/* Inserisce la coppia (key, prio) */
+void seqheap_insert(SeqHeap *h, int key, double prio);
+
+/* Rimuove la coppia con priorità minima e ne restituisce la chiave;
+   restituisce -1 nello stesso caso di `seqheap_min()`.
+
+   Precondizione: lo heap non deve essere vuoto. */
+int seqheap_delete_min(SeqHeap *h);
+
+#endif
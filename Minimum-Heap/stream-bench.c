@@ -0,0 +1,161 @@
+/****************************************************************************
+ *
+ * stream-bench.c -- Misura delle prestazioni di top-k e quantili
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Misura il numero di valori al secondo elaborati dalla selezione
+   dei k valori massimi (topk.c) e dal calcolo della mediana
+   (quantile.c), su una sequenza di n valori casuali in memoria, e la
+   velocità di lettura di valori da un file di testo con valreader.c,
+   confrontata con fscanf().
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread minheap.c valreader.c topk.c quantile.c stream-bench.c -o stream-bench
+
+   Per eseguire:
+
+        ./stream-bench [n]
+
+   dove `n` (default 10000000) è la lunghezza della sequenza. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <assert.h>
+#include "valreader.h"
+#include "topk.h"
+#include "quantile.h"
+
+#define BATCH 4096
+
+/* Restituisce un valore reale casuale in [0, 1) */
+static double randunif( void )
+{
+    return rand() / ((double)RAND_MAX + 1);
+}
+
+static double elapsed_since(clock_t tstart)
+{
+    return ((double)(clock() - tstart)) / CLOCKS_PER_SEC;
+}
+
+static void report(const char *name, int n, double elapsed)
+{
+    printf("%-24s %f seconds, %.1f M values/s\n", name, elapsed, n / elapsed / 1e6);
+}
+
+static void bench_topk(const double *v, int n, int k)
+{
+    TopK *t = topk_create(k);
+    char name[32];
+    clock_t tstart = clock();
+
+    topk_add_batch(t, v, n);
+    sprintf(name, "topk k=%d", k);
+    report(name, n, elapsed_since(tstart));
+    topk_destroy(t);
+}
+
+static void bench_quantile(const double *v, int n, double q)
+{
+    RunQuantile *r = runquantile_create(q);
+    char name[32];
+    clock_t tstart = clock();
+
+    runquantile_add_batch(r, v, n);
+    sprintf(name, "quantile q=%.2f", q);
+    report(name, n, elapsed_since(tstart));
+    runquantile_destroy(r);
+}
+
+static void bench_read(const double *v, int n)
+{
+    static double buf[BATCH];
+    FILE *f = tmpfile();
+    ValReader *reader;
+    clock_t tstart;
+    double x, sum1 = 0.0, sum2 = 0.0;
+    int i, m, count;
+
+    assert(f != NULL);
+    for (i=0; i<n; i++) {
+        fprintf(f, "%f\n", v[i]);
+    }
+
+    rewind(f);
+    tstart = clock();
+    count = 0;
+    while (1 == fscanf(f, "%lf", &x)) {
+        sum1 += x;
+        count++;
+    }
+    assert(count == n);
+    report("fscanf", n, elapsed_since(tstart));
+
+    rewind(f);
+    tstart = clock();
+    count = 0;
+    reader = valreader_create(f);
+    while ((m = valreader_read(reader, buf, BATCH)) > 0) {
+        for (i=0; i<m; i++) {
+            sum2 += buf[i];
+        }
+        count += m;
+    }
+    valreader_destroy(reader);
+    assert(count == n && sum1 == sum2);
+    report("valreader", n, elapsed_since(tstart));
+    fclose(f);
+}
+
+int main( int argc, char *argv[] )
+{
+    int n = 10000000, i;
+    double *v;
+
+    if (argc > 2) {
+        fprintf(stderr, "Usage: %s [n]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 1) {
+        n = atoi(argv[1]);
+    }
+    if (n < 1) {
+        fprintf(stderr, "Invalid n\n");
+        return EXIT_FAILURE;
+    }
+
+    v = (double*)malloc(n * sizeof(*v));
+    assert(v != NULL);
+    srand(42);
+    for (i=0; i<n; i++) {
+        v[i] = 1000.0 * randunif();
+    }
+
+    bench_topk(v, n, 10);
+    bench_topk(v, n, 1000);
+    bench_topk(v, n, 100000);
+    bench_quantile(v, n, 0.5);
+    bench_quantile(v, n, 0.99);
+    bench_read(v, n);
+
+    free(v);
+    return EXIT_SUCCESS;
+}
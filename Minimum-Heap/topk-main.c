@@ -0,0 +1,102 @@
+/****************************************************************************
+ *
+ * topk-main.c -- I k valori massimi di una sequenza
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Legge una sequenza di numeri reali, separati da spazi o da
+   ritorni a capo, da un file o dallo standard input, e stampa i `k`
+   valori massimi (default 10) in ordine non crescente, uno per
+   riga.
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread minheap.c valreader.c topk.c topk-main.c -o topk-main
+
+   Per eseguire:
+
+        ./topk-main [-k k] [inputfile]
+
+   Il nome "-", o l'assenza del nome, indica lo standard input. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "valreader.h"
+#include "topk.h"
+
+#define BATCH 4096
+
+int main( int argc, char *argv[] )
+{
+    static double v[BATCH];
+    const char *fname = "-";
+    FILE *filein = stdin;
+    ValReader *reader;
+    TopK *t;
+    double *top;
+    int k = 10, a = 1, n, i;
+
+    if (a+1 < argc && strcmp(argv[a], "-k") == 0) {
+        k = atoi(argv[a+1]);
+        a += 2;
+    }
+    if (a < argc) {
+        fname = argv[a];
+        a++;
+    }
+    if (a != argc || k < 1) {
+        fprintf(stderr, "Usage: %s [-k k] [inputfile]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(fname, "-") != 0) {
+        filein = fopen(fname, "r");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", fname);
+            return EXIT_FAILURE;
+        }
+    }
+
+    t = topk_create(k);
+    reader = valreader_create(filein);
+    while ((n = valreader_read(reader, v, BATCH)) > 0) {
+        topk_add_batch(t, v, n);
+    }
+    valreader_destroy(reader);
+    if (filein != stdin) fclose(filein);
+    if (n < 0) {
+        fprintf(stderr, "%s: invalid value after %ld values\n", fname, topk_get_n(t));
+        topk_destroy(t);
+        return EXIT_FAILURE;
+    }
+
+    top = (double*)malloc(k * sizeof(*top));
+    if (top == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return EXIT_FAILURE;
+    }
+    n = topk_get(t, top);
+    for (i=0; i<n; i++) {
+        printf("%f\n", top[i]);
+    }
+
+    free(top);
+    topk_destroy(t);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,144 @@
+/****************************************************************************
+ *
+ * topk.c -- Selezione dei k valori massimi di una sequenza
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Selezione dei k valori massimi di una sequenza
+% Ultimo aggiornamento: 2026-10-19
+
+Per individuare i $k$ valori massimi di una sequenza di lunghezza
+$n$, anche molto lunga e non memorizzabile per intero, si mantiene un
+min-heap contenente i $k$ valori massimi tra quelli esaminati finora.
+Un nuovo valore $v$ entra a far parte dei $k$ massimi se e solo se è
+maggiore del minimo dello heap, che in tal caso viene sostituito da
+$v$. Il costo è $O(n \log k)$ nel caso pessimo (sequenza crescente)
+e la memoria richiesta $O(k)$.
+
+Le chiavi dello heap sono gli interi $0, \ldots, k-1$: quando lo heap
+è pieno, la chiave del minimo viene riutilizzata per $v$ e la
+sostituzione si riduce ad una chiamata a `minheap_change_prio()`, cioè
+ad un'unica discesa nello heap, anziché un'estrazione seguita da un
+inserimento.
+
+Il minimo dello heap viene copiato nel campo `threshold`: per una
+sequenza in ordine casuale, solo $O(k \log(n/k))$ valori superano la
+soglia, per cui quasi tutti i valori vengono scartati con un solo
+confronto.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread minheap.c valreader.c topk.c topk-main.c -o topk-main
+
+## File
+
+- [topk.c](topk.c)
+- [topk.h](topk.h)
+- [topk-main.c](topk-main.c)
+- [stream-bench.c](stream-bench.c)
+
+***/
+
+#include <stdlib.h>
+#include <assert.h>
+#include "topk.h"
+
+TopK *topk_create(int k)
+{
+    TopK *t = (TopK*)malloc(sizeof(*t));
+
+    assert(t != NULL);
+    assert(k > 0);
+
+    t->h = minheap_create(k);
+    t->k = k;
+    t->threshold = 0.0;
+    t->n = 0;
+    return t;
+}
+
+void topk_destroy(TopK *t)
+{
+    assert(t != NULL);
+
+    minheap_destroy(t->h);
+    free(t);
+}
+
+void topk_add(TopK *t, double v)
+{
+    assert(t != NULL);
+
+    topk_add_batch(t, &v, 1);
+}
+
+void topk_add_batch(TopK *t, const double *v, int n)
+{
+    MinHeap *h;
+    int i;
+
+    assert(t != NULL);
+    assert(n >= 0);
+
+    h = t->h;
+    for (i=0; i<n; i++) {
+        if (v[i] != v[i]) {
+            continue; /* NaN */
+        }
+        t->n++;
+        if (minheap_get_n(h) < t->k) {
+            minheap_insert(h, minheap_get_n(h), v[i]);
+            if (minheap_get_n(h) == t->k) {
+                t->threshold = minheap_min_prio(h);
+            }
+        } else if (v[i] > t->threshold) {
+            minheap_change_prio(h, minheap_min(h), v[i]);
+            t->threshold = minheap_min_prio(h);
+        }
+    }
+}
+
+/* Funzione di supporto per qsort(): ordinamento non crescente */
+static int compare_desc(const void *a, const void *b)
+{
+    const double x = *(const double*)a, y = *(const double*)b;
+    return (x < y) - (x > y);
+}
+
+int topk_get(const TopK *t, double *out)
+{
+    int key, m = 0;
+
+    assert(t != NULL);
+
+    for (key=0; key<t->k; key++) {
+        if (minheap_contains(t->h, key)) {
+            out[m++] = minheap_get_prio(t->h, key);
+        }
+    }
+    qsort(out, m, sizeof(*out), compare_desc);
+    return m;
+}
+
+long topk_get_n(const TopK *t)
+{
+    assert(t != NULL);
+
+    return t->n;
+}
@@ -0,0 +1,60 @@
+/****************************************************************************
+ *
+ * topk.h -- Interfaccia selezione dei k valori massimi di una sequenza
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef TOPK_H
+#define TOPK_H
+
+#include "minheap.h"
+
+typedef struct {
+    MinHeap *h; /* i k valori massimi: chiave = posizione, prio = valore */
+    int k; /* numero di valori da conservare */
+    double threshold; /* minimo dei valori conservati, se ve ne sono k */
+    long n; /* numero di valori esaminati */
+} TopK;
+
+/* Crea un selettore che conserva i `k` valori massimi tra quelli
+   ricevuti.
+
+   Precondizione: k > 0 */
+TopK *topk_create(int k);
+
+/* Dealloca il selettore */
+void topk_destroy(TopK *t);
+
+/* Esamina il valore `v`; i valori NaN vengono ignorati. Costo O(1)
+   se v non è tra i k valori massimi ricevuti finora, O(log k)
+   altrimenti. */
+void topk_add(TopK *t, double v);
+
+/* Esamina i valori v[0..n-1]; equivale a n chiamate a
+   `topk_add()` */
+void topk_add_batch(TopK *t, const double *v, int n);
+
+/* Scrive in out[] i valori conservati (al più k) in ordine non
+   crescente e ne restituisce il numero. out[] deve avere almeno k
+   elementi. */
+int topk_get(const TopK *t, double *out);
+
+/* Restituisce il numero di valori esaminati */
+long topk_get_n(const TopK *t);
+
+#endif
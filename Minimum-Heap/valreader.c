@@ -0,0 +1,134 @@
+/****************************************************************************
+ *
+ * valreader.c -- Lettura a blocchi di sequenze di valori reali
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Lettura a blocchi di sequenze di valori reali
+% Ultimo aggiornamento: 2026-10-19
+
+Legge un file di testo che contiene numeri reali separati da spazi
+o da ritorni a capo. Anziché invocare `fscanf()` per ogni valore, il
+file viene letto a blocchi di `VALREADER_BLOCK` byte con `fread()`, e
+i valori vengono convertiti con `strtod()` direttamente dal buffer.
+
+Un valore può essere spezzato tra due blocchi: per questo vengono
+convertiti solo i caratteri che precedono l'ultimo spazio del buffer
+(`lim`); i caratteri successivi vengono spostati all'inizio del buffer
+prima di leggere il blocco seguente. Alla fine del file il buffer è
+terminato da '\0', per cui anche l'ultimo valore è completo.
+
+Usato da [topk-main.c](topk-main.c) e
+[quantile-main.c](quantile-main.c).
+
+## File
+
+- [valreader.c](valreader.c)
+- [valreader.h](valreader.h)
+
+***/
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "valreader.h"
+
+static int is_space(char c)
+{
+    return (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v');
+}
+
+ValReader *valreader_create(FILE *f)
+{
+    ValReader *r = (ValReader*)malloc(sizeof(*r));
+
+    assert(r != NULL);
+    assert(f != NULL);
+
+    r->f = f;
+    r->buf = (char*)malloc(VALREADER_BLOCK + 1);
+    assert(r->buf != NULL);
+    r->len = r->pos = r->lim = 0;
+    r->eof = 0;
+    return r;
+}
+
+void valreader_destroy(ValReader *r)
+{
+    assert(r != NULL);
+
+    free(r->buf);
+    free(r);
+}
+
+/* Funzione di supporto: sposta all'inizio del buffer i caratteri non
+   ancora esaminati e lo riempie con il blocco successivo del file;
+   aggiorna `lim`. Restituisce 0 se il buffer contiene un valore
+   troppo lungo. */
+static int refill(ValReader *r)
+{
+    size_t nread;
+
+    memmove(r->buf, r->buf + r->pos, r->len - r->pos);
+    r->len -= r->pos;
+    r->pos = 0;
+    nread = fread(r->buf + r->len, 1, VALREADER_BLOCK - r->len, r->f);
+    r->len += nread;
+    r->buf[r->len] = '\0';
+    if (nread == 0) {
+        r->eof = 1;
+    }
+    if (r->eof) {
+        r->lim = r->len;
+    } else {
+        r->lim = r->len;
+        while (r->lim > 0 && !is_space(r->buf[r->lim - 1]))
+            r->lim--;
+        if (r->lim == 0 && r->len == VALREADER_BLOCK)
+            return 0;
+    }
+    return 1;
+}
+
+int valreader_read(ValReader *r, double *v, int max)
+{
+    int n = 0;
+    char *end;
+
+    assert(r != NULL);
+    assert(max > 0);
+
+    while (n < max) {
+        while (r->pos < r->lim && is_space(r->buf[r->pos]))
+            r->pos++;
+        if (r->pos == r->lim) {
+            if (r->eof)
+                break;
+            if (!refill(r))
+                return (n > 0 ? n : -1);
+            continue;
+        }
+        v[n] = strtod(r->buf + r->pos, &end);
+        if (end == r->buf + r->pos || (end < r->buf + r->len && !is_space(*end)))
+            return (n > 0 ? n : -1);
+        r->pos = end - r->buf;
+        n++;
+    }
+    return n;
+}
@@ -0,0 +1,60 @@
+/****************************************************************************
+ *
+ * valreader.h -- Lettura a blocchi di sequenze di valori reali
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef VALREADER_H
+#define VALREADER_H
+
+#include <stdio.h>
+
+/* Dimensione dei blocchi letti con fread(); può essere modificata in
+   fase di compilazione, ad esempio con -DVALREADER_BLOCK=4096 */
+#ifndef VALREADER_BLOCK
+#define VALREADER_BLOCK (1 << 20)
+#endif
+
+/* Lettore di numeri reali in formato testo, separati da spazi o da
+   ritorni a capo; il file viene letto a blocchi di VALREADER_BLOCK
+   byte */
+typedef struct {
+    FILE *f;
+    char *buf; /* VALREADER_BLOCK + 1 byte */
+    size_t len; /* numero di byte validi in buf[] */
+    size_t pos; /* posizione del prossimo carattere da esaminare */
+    size_t lim; /* buf[pos..lim-1] contiene solo valori completi */
+    int eof; /* != 0 se è stata raggiunta la fine del file */
+} ValReader;
+
+/* Crea un lettore che legge da `f`, già aperto */
+ValReader *valreader_create(FILE *f);
+
+/* Dealloca il lettore; il file non viene chiuso */
+void valreader_destroy(ValReader *r);
+
+/* Legge al più `max` valori, scrivendoli in v[]; restituisce il
+   numero di valori letti (0 alla fine del file), oppure -1 se
+   l'input contiene qualcosa che non è un numero (i valori che lo
+   precedono vengono comunque restituiti dalle chiamate
+   precedenti).
+
+   Precondizione: max > 0 */
+int valreader_read(ValReader *r, double *v, int max);
+
+#endif
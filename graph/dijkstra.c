@@ -0,0 +1,114 @@
+/****************************************************************************
+ *
+ * dijkstra.c -- Algoritmo di Dijkstra
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Algoritmo di Dijkstra
+% Ultimo aggiornamento: 2026-10-19
+
+L'algoritmo di Dijkstra calcola i cammini minimi da un nodo sorgente
+$s$ in un grafo con pesi non negativi. Lo heap contiene i nodi
+raggiunti ma non ancora _definitivi_, con priorità pari alla distanza
+provvisoria; ad ogni passo si estrae il nodo $u$ con distanza minima,
+che diventa definitivo, e si "rilassano" i suoi archi uscenti: per
+ogni arco $(u, v)$ di peso $w$, se $d[u] + w < d[v]$ la distanza di
+$v$ viene aggiornata, inserendo $v$ nello heap con
+`minheap_insert()` se non è ancora stato raggiunto, oppure riducendone
+la priorità con `minheap_change_prio()`.
+
+Poiché le chiavi di `MinHeap` sono gli interi $0, \ldots, n-1$,
+coincidono con gli identificatori dei nodi, e l'array `pos[]` dello
+heap consente di ridurre la priorità di un nodo in tempo
+$O(\log n)$. Ogni nodo viene inserito ed estratto al più una volta,
+per cui il costo complessivo è $O((n + m) \log n)$. Un nodo già
+estratto non viene più modificato: la sua distanza è definitiva, e
+nessun arco con peso non negativo può ridurla.
+
+La rappresentazione CSR (si veda [graph.c](graph.c)) fa sì che gli
+archi uscenti da $u$ siano letti in sequenza.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread -I../Minimum-Heap ../Minimum-Heap/minheap.c graph.c dijkstra.c graph-main.c -lm -o graph-main
+
+## File
+
+- [dijkstra.c](dijkstra.c)
+- [dijkstra.h](dijkstra.h)
+- [graph.c](graph.c)
+- [graph.h](graph.h)
+- [graph-main.c](graph-main.c)
+- [graph-bench.c](graph-bench.c)
+
+***/
+
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+#include "dijkstra.h"
+#include "minheap.h"
+
+int dijkstra(const Graph *g, int s, double *dist, int *pred)
+{
+    MinHeap *h;
+    int u, v, j, nreached = 0;
+    double du, d;
+
+    assert(g != NULL);
+    assert(s >= 0 && s < g->n);
+    assert(dist != NULL);
+
+    h = minheap_create(g->n);
+    for (v=0; v<g->n; v++) {
+        dist[v] = HUGE_VAL;
+    }
+    if (pred != NULL) {
+        for (v=0; v<g->n; v++) {
+            pred[v] = -1;
+        }
+    }
+    dist[s] = 0.0;
+    minheap_insert(h, s, 0.0);
+    while (!minheap_is_empty(h)) {
+        u = minheap_delete_min(h);
+        du = dist[u];
+        nreached++;
+        for (j=g->offset[u]; j<g->offset[u+1]; j++) {
+            assert(g->w[j] >= 0.0);
+            v = g->dst[j];
+            d = du + g->w[j];
+            if (d < dist[v]) {
+                /* v non può essere definitivo: la sua distanza è
+                   minore o uguale a du */
+                if (dist[v] == HUGE_VAL) {
+                    minheap_insert(h, v, d);
+                } else {
+                    minheap_change_prio(h, v, d);
+                }
+                dist[v] = d;
+                if (pred != NULL) {
+                    pred[v] = u;
+                }
+            }
+        }
+    }
+    minheap_destroy(h);
+    return nreached;
+}
@@ -0,0 +1,39 @@
+/****************************************************************************
+ *
+ * dijkstra.h -- Interfaccia algoritmo di Dijkstra
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef DIJKSTRA_H
+#define DIJKSTRA_H
+
+#include "graph.h"
+
+/* Calcola i cammini minimi dal nodo `s` a tutti gli altri nodi del
+   grafo `g`. Al termine dist[v] è la distanza da s a v (HUGE_VAL se
+   v non è raggiungibile) e, se `pred` non è NULL, pred[v] è il
+   predecessore di v nel cammino minimo (-1 se v = s o se v non è
+   raggiungibile). Restituisce il numero di nodi raggiungibili.
+
+   Precondizioni:
+   - 0 <= s < g->n;
+   - i pesi degli archi non sono negativi;
+   - dist[] (e pred[], se non è NULL) hanno g->n elementi. */
+int dijkstra(const Graph *g, int s, double *dist, int *pred);
+
+#endif
@@ -0,0 +1,237 @@
+/****************************************************************************
+ *
+ * graph-bench.c -- Misura delle prestazioni dell'algoritmo di Dijkstra
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Genera un grafo simile ad una rete stradale e misura il tempo
+   richiesto per costruire la rappresentazione CSR, per scrivere e
+   rileggere il grafo in formato binario, per eseguire l'algoritmo
+   di Dijkstra da alcune sorgenti casuali e per calcolare l'albero
+   ricoprente minimo con l'algoritmo di Prim.
+
+   Il grafo ha side*side nodi, disposti (con una piccola perturbazione
+   casuale) sui punti di una griglia. Ogni nodo è collegato ai vicini
+   a destra e in basso, in entrambe le direzioni, con probabilità
+   0.85; il peso di un arco è la lunghezza del segmento moltiplicata
+   per un fattore casuale in [1, 1.5) (la "lentezza" della strada).
+   Una riga e una colonna ogni HIGHWAY_STEP sono "autostrade": tutti i
+   loro archi sono presenti, con fattore 0.3. Come nelle reti stradali
+   il grado medio è basso (circa 3.4 archi uscenti per nodo) e il
+   diametro, misurato in archi, è grande.
+
+   Infine l'algoritmo di Prim viene eseguito, con entrambe le
+   versioni, su un grafo completo con side nodi e pesi casuali.
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread -I../Minimum-Heap ../Minimum-Heap/minheap.c graph.c dijkstra.c prim.c graph-bench.c -lm -o graph-bench
+
+   Per eseguire:
+
+        ./graph-bench [side [nsources]]
+
+   dove `side` (default 3000, cioè 9 milioni di nodi e circa 30
+   milioni di archi) è il lato della griglia e `nsources` (default 3)
+   il numero di esecuzioni dell'algoritmo di Dijkstra. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <assert.h>
+#include "graph.h"
+#include "dijkstra.h"
+#include "prim.h"
+
+#define HIGHWAY_STEP 64
+
+/* Restituisce un valore reale casuale in [0, 1) */
+static double randunif( void )
+{
+    return rand() / ((double)RAND_MAX + 1);
+}
+
+static double elapsed_since(clock_t tstart)
+{
+    return ((double)(clock() - tstart)) / CLOCKS_PER_SEC;
+}
+
+/* Aggiunge gli archi (u, v) e (v, u) tra due nodi vicini, le cui
+   coordinate sono (x[u], y[u]) e (x[v], y[v]) */
+static void add_road(int u, int v, const double *x, const double *y, int highway,
+                     int *src, int *dst, double *w, int *m)
+{
+    const double len = sqrt((x[u]-x[v])*(x[u]-x[v]) + (y[u]-y[v])*(y[u]-y[v]));
+    const double wt = len * (highway ? 0.3 : 1.0 + 0.5*randunif());
+
+    src[*m] = u; dst[*m] = v; w[*m] = wt; (*m)++;
+    src[*m] = v; dst[*m] = u; w[*m] = wt; (*m)++;
+}
+
+static Graph *make_road_graph(int side)
+{
+    const int n = side * side;
+    const int max_m = 4 * n;
+    int *src = (int*)malloc(max_m * sizeof(*src));
+    int *dst = (int*)malloc(max_m * sizeof(*dst));
+    double *w = (double*)malloc(max_m * sizeof(*w));
+    double *x = (double*)malloc(n * sizeof(*x));
+    double *y = (double*)malloc(n * sizeof(*y));
+    int r, c, m = 0;
+    Graph *g;
+
+    assert(src != NULL && dst != NULL && w != NULL && x != NULL && y != NULL);
+    for (r=0; r<side; r++) {
+        for (c=0; c<side; c++) {
+            x[r*side + c] = c + 0.4*(randunif() - 0.5);
+            y[r*side + c] = r + 0.4*(randunif() - 0.5);
+        }
+    }
+    for (r=0; r<side; r++) {
+        for (c=0; c<side; c++) {
+            const int u = r*side + c;
+            if (c+1 < side && (r % HIGHWAY_STEP == 0 || randunif() < 0.85)) {
+                add_road(u, u+1, x, y, r % HIGHWAY_STEP == 0, src, dst, w, &m);
+            }
+            if (r+1 < side && (c % HIGHWAY_STEP == 0 || randunif() < 0.85)) {
+                add_road(u, u+side, x, y, c % HIGHWAY_STEP == 0, src, dst, w, &m);
+            }
+        }
+    }
+    g = graph_create(n, m, src, dst, w);
+    free(src);
+    free(dst);
+    free(w);
+    free(x);
+    free(y);
+    return g;
+}
+
+static Graph *make_complete_graph(int n)
+{
+    const int m = n * (n-1);
+    int *src = (int*)malloc(m * sizeof(*src));
+    int *dst = (int*)malloc(m * sizeof(*dst));
+    double *w = (double*)malloc(m * sizeof(*w));
+    int u, v, j = 0;
+    Graph *g;
+
+    assert(src != NULL && dst != NULL && w != NULL);
+    for (u=0; u<n; u++) {
+        for (v=u+1; v<n; v++) {
+            src[j] = u; dst[j] = v; w[j] = randunif(); j++;
+            src[j] = v; dst[j] = u; w[j] = w[j-1]; j++;
+        }
+    }
+    g = graph_create(n, m, src, dst, w);
+    free(src);
+    free(dst);
+    free(w);
+    return g;
+}
+
+/* Esegue la funzione `mst` sul grafo `g` e ne stampa il tempo */
+static void bench_prim(const char *name, double (*mst)(const Graph *, int *, double *),
+                       const Graph *g)
+{
+    int *pred = (int*)malloc(g->n * sizeof(*pred));
+    clock_t tstart;
+    double elapsed, total;
+
+    assert(pred != NULL);
+    tstart = clock();
+    total = mst(g, pred, NULL);
+    elapsed = elapsed_since(tstart);
+    printf("%-10s %f seconds, weight %f, %.1f M edges/s\n",
+           name, elapsed, total, g->m / elapsed / 1e6);
+    free(pred);
+}
+
+int main( int argc, char *argv[] )
+{
+    int side = 3000, nsources = 3, i, reached;
+    clock_t tstart;
+    double elapsed;
+    double *dist;
+    Graph *g, *g2;
+    FILE *f;
+
+    if (argc > 3) {
+        fprintf(stderr, "Usage: %s [side [nsources]]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    if (argc > 1) {
+        side = atoi(argv[1]);
+    }
+    if (argc > 2) {
+        nsources = atoi(argv[2]);
+    }
+    if (side < 2 || side > 20000 || nsources < 0) {
+        fprintf(stderr, "Invalid arguments\n");
+        return EXIT_FAILURE;
+    }
+
+    srand(42);
+    tstart = clock();
+    g = make_road_graph(side);
+    printf("road graph: %d nodes, %d edges (generated in %f seconds)\n",
+           g->n, g->m, elapsed_since(tstart));
+
+    f = tmpfile();
+    assert(f != NULL);
+    tstart = clock();
+    if (graph_save_binary(g, f) != 0) {
+        fprintf(stderr, "Error writing temporary file\n");
+        return EXIT_FAILURE;
+    }
+    fflush(f);
+    printf("graph_save_binary  %f seconds\n", elapsed_since(tstart));
+    rewind(f);
+    tstart = clock();
+    g2 = graph_load_binary(f);
+    printf("graph_load_binary  %f seconds\n", elapsed_since(tstart));
+    fclose(f);
+    assert(g2 != NULL && g2->n == g->n && g2->m == g->m);
+    graph_destroy(g2);
+
+    dist = (double*)malloc(g->n * sizeof(*dist));
+    assert(dist != NULL);
+    for (i=0; i<nsources; i++) {
+        const int s = (int)(randunif() * g->n);
+        tstart = clock();
+        reached = dijkstra(g, s, dist, NULL);
+        elapsed = elapsed_since(tstart);
+        printf("dijkstra(s=%d)  %f seconds, %d nodes reached, %.1f M edges/s\n",
+               s, elapsed, reached, g->offset[g->n] / elapsed / 1e6);
+    }
+
+    free(dist);
+
+    bench_prim("prim", prim, g);
+    graph_destroy(g);
+
+    if (side <= 5000) {
+        g = make_complete_graph(side);
+        printf("complete graph: %d nodes, %d edges\n", g->n, g->m);
+        bench_prim("prim_heap", prim_heap, g);
+        bench_prim("prim_dense", prim_dense, g);
+        graph_destroy(g);
+    }
+    return EXIT_SUCCESS;
+}
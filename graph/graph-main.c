@@ -0,0 +1,132 @@
+/****************************************************************************
+ *
+ * graph-main.c -- Cammini minimi da file
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Legge un grafo da file ed esegue l'algoritmo di Dijkstra a partire
+   dal nodo `s`, stampando per ogni nodo v una riga "v dist pred"
+   (dist = inf se v non è raggiungibile), oppure converte un grafo
+   dal formato testo al formato binario (si veda graph.h).
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread -I../Minimum-Heap ../Minimum-Heap/minheap.c graph.c dijkstra.c graph-main.c -lm -o graph-main
+
+   Per eseguire:
+
+        ./graph-main graph.in 0
+        ./graph-main -b graph.bin 0
+        ./graph-main -c graph.in graph.bin
+
+   Con l'opzione -b il grafo viene letto in formato binario; con -c
+   il grafo in formato testo viene convertito in formato binario. Il
+   nome "-" indica lo standard input. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "graph.h"
+#include "dijkstra.h"
+
+static Graph *load(const char *fname, int binary)
+{
+    FILE *f = stdin;
+    Graph *g;
+
+    if (strcmp(fname, "-") != 0) {
+        f = fopen(fname, binary ? "rb" : "r");
+        if (f == NULL) {
+            fprintf(stderr, "Can not open %s\n", fname);
+            return NULL;
+        }
+    }
+    g = (binary ? graph_load_binary(f) : graph_load_text(f));
+    if (f != stdin) fclose(f);
+    return g;
+}
+
+int main( int argc, char *argv[] )
+{
+    Graph *g;
+    double *dist;
+    int *pred;
+    int s, v, binary = 0;
+
+    if (argc == 4 && strcmp(argv[1], "-c") == 0) {
+        FILE *out;
+        int err;
+        g = load(argv[2], 0);
+        if (g == NULL) {
+            return EXIT_FAILURE;
+        }
+        out = fopen(argv[3], "wb");
+        if (out == NULL) {
+            fprintf(stderr, "Can not open %s\n", argv[3]);
+            graph_destroy(g);
+            return EXIT_FAILURE;
+        }
+        err = graph_save_binary(g, out);
+        err = (fclose(out) != 0 || err != 0);
+        graph_destroy(g);
+        if (err) {
+            fprintf(stderr, "Error writing %s\n", argv[3]);
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    if (argc == 4 && strcmp(argv[1], "-b") == 0) {
+        binary = 1;
+    } else if (argc != 3) {
+        fprintf(stderr, "Usage: %s [-b] inputfile source\n", argv[0]);
+        fprintf(stderr, "       %s -c inputfile outputfile\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    g = load(argv[1 + binary], binary);
+    if (g == NULL) {
+        return EXIT_FAILURE;
+    }
+    s = atoi(argv[2 + binary]);
+    if (s < 0 || s >= g->n) {
+        fprintf(stderr, "Invalid source %d\n", s);
+        graph_destroy(g);
+        return EXIT_FAILURE;
+    }
+
+    dist = (double*)malloc(g->n * sizeof(*dist));
+    pred = (int*)malloc(g->n * sizeof(*pred));
+    if (dist == NULL || pred == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return EXIT_FAILURE;
+    }
+    dijkstra(g, s, dist, pred);
+    for (v=0; v<g->n; v++) {
+        if (dist[v] == HUGE_VAL) {
+            printf("%d inf %d\n", v, pred[v]);
+        } else {
+            printf("%d %f %d\n", v, dist[v], pred[v]);
+        }
+    }
+
+    free(dist);
+    free(pred);
+    graph_destroy(g);
+    return EXIT_SUCCESS;
+}
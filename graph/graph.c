@@ -0,0 +1,435 @@
+/****************************************************************************
+ *
+ * graph.c -- Grafi orientati pesati in formato CSR
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Grafi orientati pesati in formato CSR
+% Ultimo aggiornamento: 2026-10-19
+
+Un grafo con $n$ nodi e $m$ archi viene memorizzato in formato _CSR_
+(_Compressed Sparse Row_): gli archi sono ordinati per nodo di
+origine, e per ciascun arco si memorizzano solo la destinazione
+(`dst[]`) e il peso (`w[]`); l'array `offset[]` di $n+1$ elementi
+indica dove iniziano gli archi uscenti da ciascun nodo. Rispetto alle
+liste di adiacenza con un nodo allocato per ogni arco, il formato CSR
+occupa meno memoria (12 byte per arco) e, soprattutto, gli archi
+uscenti da un nodo sono contigui: visitarli richiede accessi
+sequenziali alla memoria.
+
+`graph_create()` costruisce la rappresentazione CSR a partire da un
+elenco di archi in tempo $O(n+m)$, con un ordinamento per conteggio
+(_counting sort_) dei nodi di origine: prima si conta il grado
+uscente di ogni nodo, poi si calcolano le somme prefisse, che
+indicano dove scrivere gli archi di ciascun nodo.
+
+I grafi possono essere letti da file in due formati:
+
+- testo: la prima riga contiene $n$ e $m$, ciascuna delle $m$ righe
+  successive un arco `src dst peso`. L'intero file viene letto in
+  memoria con poche chiamate a `fread()` e poi convertito;
+
+- binario: $n$ e $m$, seguiti da $m$ terne (`src`, `dst`, `peso`)
+  nella rappresentazione interna della macchina. La lettura non
+  richiede alcuna conversione, per cui è molto più veloce: conviene
+  convertire una volta per tutte i grafi di grandi dimensioni con
+  `graph_save_binary()` (si veda [graph-main.c](graph-main.c)).
+
+## File
+
+- [graph.c](graph.c)
+- [graph.h](graph.h)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <float.h>
+#include <assert.h>
+#include "graph.h"
+
+#define READ_BLOCK (1 << 20)
+
+/* Numero di archi letti o scritti con una singola operazione nel
+   formato binario */
+#define BIN_BLOCK 65536
+
+/* Numero minimo di caratteri di un arco nel formato testo: un
+   separatore seguito da "src dst peso", ad esempio "\n0 1 2" */
+#define MIN_TEXT_EDGE 6
+
+/* Arco nel formato binario */
+typedef struct {
+    int src, dst;
+    double w;
+} BinEdge;
+
+/* Funzione di supporto: come graph_create(), ma restituisce NULL se
+   non c'è memoria sufficiente */
+static Graph *build(int n, int m, const int *src, const int *dst, const double *w)
+{
+    Graph *g = (Graph*)malloc(sizeof(*g));
+    int *next;
+    int u, j;
+
+    assert(n > 0);
+    assert(m >= 0);
+
+    if (g == NULL)
+        return NULL;
+    g->n = n;
+    g->m = m;
+    g->offset = (int*)calloc((size_t)n + 1, sizeof(*(g->offset)));
+    g->dst = (int*)malloc((m > 0 ? m : 1) * sizeof(*(g->dst)));
+    g->w = (double*)malloc((m > 0 ? m : 1) * sizeof(*(g->w)));
+    next = (int*)malloc(n * sizeof(*next));
+    if (g->offset == NULL || g->dst == NULL || g->w == NULL || next == NULL) {
+        free(next);
+        graph_destroy(g);
+        return NULL;
+    }
+
+    for (j=0; j<m; j++) {
+        assert(src[j] >= 0 && src[j] < n);
+        assert(dst[j] >= 0 && dst[j] < n);
+        g->offset[src[j] + 1]++;
+    }
+    for (u=0; u<n; u++) {
+        g->offset[u+1] += g->offset[u];
+        next[u] = g->offset[u];
+    }
+    for (j=0; j<m; j++) {
+        const int k = next[src[j]]++;
+        g->dst[k] = dst[j];
+        g->w[k] = w[j];
+    }
+    free(next);
+    return g;
+}
+
+Graph *graph_create(int n, int m, const int *src, const int *dst, const double *w)
+{
+    Graph *g = build(n, m, src, dst, w);
+
+    assert(g != NULL);
+    return g;
+}
+
+void graph_destroy(Graph *g)
+{
+    assert(g != NULL);
+
+    free(g->offset);
+    free(g->dst);
+    free(g->w);
+    free(g);
+}
+
+Graph *graph_undirected(const Graph *g)
+{
+    int *src, *dst;
+    double *w;
+    int u, j, k = 0;
+    Graph *result;
+
+    assert(g != NULL);
+    assert(g->m <= INT_MAX / 2);
+
+    src = (int*)malloc((2*g->m > 0 ? 2*g->m : 1) * sizeof(*src));
+    dst = (int*)malloc((2*g->m > 0 ? 2*g->m : 1) * sizeof(*dst));
+    w = (double*)malloc((2*g->m > 0 ? 2*g->m : 1) * sizeof(*w));
+    assert(src != NULL && dst != NULL && w != NULL);
+    for (u=0; u<g->n; u++) {
+        for (j=g->offset[u]; j<g->offset[u+1]; j++) {
+            src[k] = u; dst[k] = g->dst[j]; w[k] = g->w[j]; k++;
+            src[k] = g->dst[j]; dst[k] = u; w[k] = g->w[j]; k++;
+        }
+    }
+    result = graph_create(g->n, k, src, dst, w);
+    free(src);
+    free(dst);
+    free(w);
+    return result;
+}
+
+int graph_out_degree(const Graph *g, int u)
+{
+    assert(g != NULL);
+    assert(u >= 0 && u < g->n);
+
+    return g->offset[u+1] - g->offset[u];
+}
+
+/* Legge tutto il contenuto di `f`; restituisce un buffer allocato
+   con malloc(), terminato da '\0', e ne scrive la lunghezza in *len.
+   Restituisce NULL se non c'è memoria sufficiente. */
+static char *read_all(FILE *f, size_t *len)
+{
+    size_t cap = READ_BLOCK, n = 0, r;
+    char *buf = (char*)malloc(cap + 1), *tmp;
+
+    if (buf == NULL)
+        return NULL;
+    while ((r = fread(buf + n, 1, cap - n, f)) > 0) {
+        n += r;
+        if (n == cap) {
+            cap *= 2;
+            tmp = (char*)realloc(buf, cap + 1);
+            if (tmp == NULL) {
+                free(buf);
+                return NULL;
+            }
+            buf = tmp;
+        }
+    }
+    buf[n] = '\0';
+    *len = n;
+    return buf;
+}
+
+/* Funzione di supporto: porta a `cap` elementi la capacità degli
+   array degli archi (che possono essere NULL). Restituisce 0 se non
+   c'è memoria sufficiente; in tal caso gli array restano validi e
+   vanno comunque liberati. */
+static int grow_edges(int cap, int **src, int **dst, double **w)
+{
+    int *s, *d;
+    double *x;
+
+    if (cap < 1)
+        cap = 1;
+    s = (int*)realloc(*src, cap * sizeof(**src));
+    if (s == NULL)
+        return 0;
+    *src = s;
+    d = (int*)realloc(*dst, cap * sizeof(**dst));
+    if (d == NULL)
+        return 0;
+    *dst = d;
+    x = (double*)realloc(*w, cap * sizeof(**w));
+    if (x == NULL)
+        return 0;
+    *w = x;
+    return 1;
+}
+
+/* Funzione di supporto: restituisce 1 se `w` è un peso valido, cioè
+   un valore finito non negativo (la condizione è falsa anche se `w`
+   è NaN) */
+static int valid_weight(double w)
+{
+    return (w >= 0.0 && w <= DBL_MAX);
+}
+
+/* Funzione di supporto: converte l'intero che inizia in *p, e sposta
+   *p dopo di esso. Restituisce 0 se non c'è un intero valido in
+   [lo, hi]. */
+static int parse_int(char **p, long lo, long hi, int *out)
+{
+    char *end;
+    const long x = strtol(*p, &end, 10);
+
+    if (end == *p || x < lo || x > hi)
+        return 0;
+    *p = end;
+    *out = (int)x;
+    return 1;
+}
+
+static int parse_double(char **p, double *out)
+{
+    char *end;
+    const double x = strtod(*p, &end);
+
+    if (end == *p)
+        return 0;
+    *p = end;
+    *out = x;
+    return 1;
+}
+
+/* Funzione di supporto: converte gli m archi di un grafo con n nodi
+   a partire da `p`. Restituisce -1 in caso di successo, altrimenti
+   l'indice del primo arco non valido. */
+static int parse_edges(char *p, int n, int m, int *src, int *dst, double *w)
+{
+    int j;
+
+    for (j=0; j<m; j++) {
+        if (!parse_int(&p, 0, n-1, &src[j]) ||
+            !parse_int(&p, 0, n-1, &dst[j]) ||
+            !parse_double(&p, &w[j]) ||
+            !valid_weight(w[j])) {
+            return j;
+        }
+    }
+    return -1;
+}
+
+Graph *graph_load_text(FILE *f)
+{
+    char *text, *p;
+    size_t len;
+    int n, m, bad;
+    int *src = NULL, *dst = NULL;
+    double *w = NULL;
+    Graph *g = NULL;
+
+    assert(f != NULL);
+
+    p = text = read_all(f, &len);
+    if (text == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return NULL;
+    }
+    if (!parse_int(&p, 1, 2147483647L, &n) || !parse_int(&p, 0, 2147483647L, &m)) {
+        fprintf(stderr, "Missing number of nodes or edges\n");
+        free(text);
+        return NULL;
+    }
+    /* il numero di archi dichiarato non può superare quello degli
+       archi che il resto del testo è in grado di contenere; in questo
+       modo un'intestazione errata non provoca allocazioni enormi */
+    if ((size_t)m > (len - (size_t)(p - text)) / MIN_TEXT_EDGE) {
+        fprintf(stderr, "Truncated file\n");
+    } else if (!grow_edges(m, &src, &dst, &w)) {
+        fprintf(stderr, "Out of memory\n");
+    } else if ((bad = parse_edges(p, n, m, src, dst, w)) >= 0) {
+        fprintf(stderr, "Invalid edge %d\n", bad);
+    } else if ((g = build(n, m, src, dst, w)) == NULL) {
+        fprintf(stderr, "Out of memory\n");
+    }
+    free(src);
+    free(dst);
+    free(w);
+    free(text);
+    return g;
+}
+
+/* Funzione di supporto: legge da `f` gli m archi di un grafo con n
+   nodi in formato binario, allocando gli array *src, *dst e *w.
+   Poiché `f` può essere una pipe, di cui non si conosce la
+   lunghezza, gli array vengono ingranditi man mano che gli archi
+   vengono letti: un valore di m errato non provoca allocazioni
+   maggiori del contenuto effettivo del file. Restituisce 0 in caso
+   di successo, -1 (dopo aver stampato un messaggio su stderr) se il
+   file è troncato, contiene archi non validi o se non c'è memoria
+   sufficiente; in ogni caso gli array vanno liberati dal
+   chiamante. */
+static int read_edges(FILE *f, int n, int m, int **src, int **dst, double **w)
+{
+    BinEdge *buf = (BinEdge*)malloc(BIN_BLOCK * sizeof(*buf));
+    int j, k, nb, cap = 0, ok = 1;
+
+    if (buf == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return -1;
+    }
+    for (j=0; j<m && ok; j+=nb) {
+        nb = (m - j < BIN_BLOCK ? m - j : BIN_BLOCK);
+        if (fread(buf, sizeof(*buf), nb, f) != (size_t)nb) {
+            fprintf(stderr, "Truncated file\n");
+            ok = 0;
+            break;
+        }
+        if (j + nb > cap) {
+            cap = (cap <= m / 2 ? 2 * cap : m);
+            if (cap < j + nb)
+                cap = j + nb;
+            if (!grow_edges(cap, src, dst, w)) {
+                fprintf(stderr, "Out of memory\n");
+                ok = 0;
+                break;
+            }
+        }
+        for (k=0; k<nb && ok; k++) {
+            if (buf[k].src < 0 || buf[k].src >= n || buf[k].dst < 0 || buf[k].dst >= n ||
+                !valid_weight(buf[k].w)) {
+                fprintf(stderr, "Invalid edge %d\n", j + k);
+                ok = 0;
+            }
+            (*src)[j+k] = buf[k].src;
+            (*dst)[j+k] = buf[k].dst;
+            (*w)[j+k] = buf[k].w;
+        }
+    }
+    free(buf);
+    return (ok ? 0 : -1);
+}
+
+Graph *graph_load_binary(FILE *f)
+{
+    Graph *g = NULL;
+    int header[2];
+    int *src = NULL, *dst = NULL;
+    double *w = NULL;
+    int n, m;
+
+    assert(f != NULL);
+
+    if (fread(header, sizeof(*header), 2, f) != 2 || header[0] <= 0 || header[1] < 0) {
+        fprintf(stderr, "Invalid header\n");
+        return NULL;
+    }
+    n = header[0];
+    m = header[1];
+    if (read_edges(f, n, m, &src, &dst, &w) == 0) {
+        g = build(n, m, src, dst, w);
+        if (g == NULL) {
+            fprintf(stderr, "Out of memory\n");
+        }
+    }
+    free(src);
+    free(dst);
+    free(w);
+    return g;
+}
+
+int graph_save_binary(const Graph *g, FILE *f)
+{
+    BinEdge *buf = (BinEdge*)malloc(BIN_BLOCK * sizeof(*buf));
+    int header[2];
+    int u, j, nb = 0, ok = 1;
+
+    assert(g != NULL);
+    assert(f != NULL);
+    assert(buf != NULL);
+
+    header[0] = g->n;
+    header[1] = g->m;
+    ok = (fwrite(header, sizeof(*header), 2, f) == 2);
+    for (u=0; u<g->n && ok; u++) {
+        for (j=g->offset[u]; j<g->offset[u+1] && ok; j++) {
+            buf[nb].src = u;
+            buf[nb].dst = g->dst[j];
+            buf[nb].w = g->w[j];
+            nb++;
+            if (nb == BIN_BLOCK) {
+                ok = (fwrite(buf, sizeof(*buf), nb, f) == (size_t)nb);
+                nb = 0;
+            }
+        }
+    }
+    if (ok && nb > 0) {
+        ok = (fwrite(buf, sizeof(*buf), nb, f) == (size_t)nb);
+    }
+    free(buf);
+    return (ok ? 0 : -1);
+}
@@ -0,0 +1,85 @@
+/****************************************************************************
+ *
+ * graph.h -- Interfaccia grafi orientati pesati (CSR)
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef GRAPH_H
+#define GRAPH_H
+
+#include <stdio.h>
+
+/* Grafo orientato pesato con n nodi (numerati da 0 a n-1) e m archi,
+   memorizzato in formato CSR (Compressed Sparse Row): gli archi
+   uscenti dal nodo u sono quelli di indice offset[u], ...,
+   offset[u+1]-1; l'arco di indice j va da u a dst[j] e ha peso
+   w[j]. */
+typedef struct {
+    int n; /* numero di nodi */
+    int m; /* numero di archi */
+    int *offset; /* array di n+1 elementi */
+    int *dst; /* nodo di destinazione di ciascun arco */
+    double *w; /* peso di ciascun arco */
+} Graph;
+
+/* Crea un grafo con `n` nodi e gli `m` archi (src[j], dst[j]) di
+   peso w[j], j = 0, ..., m-1. Gli archi uscenti da ciascun nodo
+   mantengono l'ordine in cui compaiono negli array; il tempo
+   richiesto è O(n + m). Gli array non vengono modificati.
+
+   Precondizioni: n > 0, m >= 0, 0 <= src[j], dst[j] < n */
+Graph *graph_create(int n, int m, const int *src, const int *dst, const double *w);
+
+/* Dealloca il grafo */
+void graph_destroy(Graph *g);
+
+/* Legge un grafo in formato testo: la prima riga contiene il numero
+   di nodi n e il numero di archi m, ciascuna delle m righe
+   successive un arco nella forma "src dst peso". I pesi devono
+   essere valori finiti non negativi. Restituisce NULL (dopo aver
+   stampato un messaggio su stderr) se il contenuto non è valido o se
+   non c'è memoria sufficiente. */
+Graph *graph_load_text(FILE *f);
+
+/* Legge un grafo in formato binario, scritto da
+   `graph_save_binary()`. Restituisce NULL (dopo aver stampato un
+   messaggio su stderr) se il contenuto non è valido, ad esempio se
+   un peso è negativo o non finito, o se non c'è memoria
+   sufficiente. */
+Graph *graph_load_binary(FILE *f);
+
+/* Scrive il grafo `g` in formato binario: il numero di nodi e di
+   archi (due `int`), poi m terne (src, dst, peso) nell'ordine degli
+   archi nel formato CSR, nella rappresentazione interna della
+   macchina. Restituisce 0 in caso di successo, -1 in caso di errore
+   di scrittura. */
+int graph_save_binary(const Graph *g, FILE *f);
+
+/* Restituisce un nuovo grafo che contiene, per ogni arco (u, v) di
+   peso w di `g`, sia l'arco (u, v) che l'arco (v, u), entrambi di
+   peso w; in questo modo un grafo non orientato, descritto elencando
+   ogni arco una volta sola, può essere elaborato dagli algoritmi che
+   operano su grafi orientati (ad esempio l'algoritmo di Prim).
+
+   Precondizione: 2*g->m è rappresentabile come `int` */
+Graph *graph_undirected(const Graph *g);
+
+/* Restituisce il numero di archi uscenti dal nodo `u` */
+int graph_out_degree(const Graph *g, int u);
+
+#endif
@@ -0,0 +1,120 @@
+/****************************************************************************
+ *
+ * prim-main.c -- Albero ricoprente minimo con l'algoritmo di Prim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Legge un grafo non orientato da file e ne calcola una foresta
+   ricoprente di peso minimo con l'algoritmo di Prim. Il file ha lo
+   stesso formato usato da graph-main (si veda graph.h), ma ogni arco
+   viene considerato non orientato: è sufficiente elencarlo una volta.
+
+   Stampa gli archi della foresta, uno per riga nella forma "u v w"
+   dove u = pred[v] e w è il peso dell'arco, e infine il peso
+   complessivo e il numero di archi.
+
+   Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread -I../Minimum-Heap ../Minimum-Heap/minheap.c graph.c prim.c prim-main.c -lm -o prim-main
+
+   Per eseguire:
+
+        ./prim-main prim.in
+        ./prim-main -b graph.bin
+        ./prim-main -heap prim.in
+        ./prim-main -dense prim.in
+
+   Con l'opzione -b il grafo viene letto in formato binario; le
+   opzioni -heap e -dense forzano l'uso di `prim_heap()` o
+   `prim_dense()` anziché la scelta automatica di `prim()`. Il nome
+   "-" indica lo standard input. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "graph.h"
+#include "prim.h"
+
+static Graph *load(const char *fname, int binary)
+{
+    FILE *f = stdin;
+    Graph *g;
+
+    if (strcmp(fname, "-") != 0) {
+        f = fopen(fname, binary ? "rb" : "r");
+        if (f == NULL) {
+            fprintf(stderr, "Can not open %s\n", fname);
+            return NULL;
+        }
+    }
+    g = (binary ? graph_load_binary(f) : graph_load_text(f));
+    if (f != stdin) fclose(f);
+    return g;
+}
+
+int main( int argc, char *argv[] )
+{
+    double (*mst)(const Graph *, int *, double *) = prim;
+    Graph *g, *ug;
+    double *key, total;
+    int *pred;
+    int v, nedges = 0, binary = 0, a = 1;
+
+    for ( ; a+1 < argc; a++) {
+        if (strcmp(argv[a], "-b") == 0) {
+            binary = 1;
+        } else if (strcmp(argv[a], "-heap") == 0) {
+            mst = prim_heap;
+        } else if (strcmp(argv[a], "-dense") == 0) {
+            mst = prim_dense;
+        } else {
+            break;
+        }
+    }
+    if (a+1 != argc) {
+        fprintf(stderr, "Usage: %s [-b] [-heap | -dense] inputfile\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    g = load(argv[a], binary);
+    if (g == NULL) {
+        return EXIT_FAILURE;
+    }
+    ug = graph_undirected(g);
+    graph_destroy(g);
+
+    pred = (int*)malloc(ug->n * sizeof(*pred));
+    key = (double*)malloc(ug->n * sizeof(*key));
+    if (pred == NULL || key == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        return EXIT_FAILURE;
+    }
+    total = mst(ug, pred, key);
+    for (v=0; v<ug->n; v++) {
+        if (pred[v] >= 0) {
+            printf("%d %d %f\n", pred[v], v, key[v]);
+            nedges++;
+        }
+    }
+    printf("MST weight %f (%d edges)\n", total, nedges);
+
+    free(pred);
+    free(key);
+    graph_destroy(ug);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,198 @@
+/****************************************************************************
+ *
+ * prim.c -- Algoritmo di Prim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Algoritmo di Prim
+% Ultimo aggiornamento: 2026-10-19
+
+L'algoritmo di Prim costruisce un albero ricoprente di peso minimo
+(_Minimum Spanning Tree_, MST) di un grafo non orientato connesso,
+aggiungendo un nodo alla volta: ad ogni passo viene aggiunto il nodo
+$v$ non ancora incluso che è collegato all'albero dall'arco di peso
+minimo. Per ogni nodo $v$ non ancora incluso si mantiene `key[v]`, il
+peso dell'arco più leggero che collega $v$ ad un nodo dell'albero, e
+`pred[v]`, l'altro estremo di tale arco; quando un nodo $u$ viene
+aggiunto, si aggiornano `key[]` e `pred[]` dei suoi vicini.
+
+La struttura dell'algoritmo è la stessa dell'algoritmo di Dijkstra
+(si veda [dijkstra.c](dijkstra.c)); cambia solo la priorità di un
+nodo, che è il peso di un singolo arco anziché la lunghezza di un
+cammino. Se il grafo non è connesso, l'algoritmo viene ripetuto a
+partire da un nodo non ancora incluso, e si ottiene una foresta con
+un albero per ogni componente connessa.
+
+Sono disponibili due versioni:
+
+- `prim_heap()` mantiene i nodi non ancora inclusi, ma già collegati
+  all'albero da almeno un arco, in un `MinHeap` con chiave il nodo e
+  priorità `key[v]`; il costo è $O((n + m) \log n)$;
+
+- `prim_dense()` individua il nodo successivo scandendo tutti i nodi
+  non ancora inclusi; il costo è $O(n^2 + m)$, che è inferiore al
+  precedente quando $m$ è vicino a $n^2$. I nodi non inclusi sono
+  mantenuti in un array compatto (un nodo incluso viene sostituito
+  dall'ultimo), insieme ai rispettivi valori di `key[]`, in modo che
+  la scansione legga memoria contigua e diventi via via più breve.
+
+`prim()` sceglie la versione con array se $m \geq n^2 /
+\texttt{PRIM\_DENSE\_RATIO}$.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread -I../Minimum-Heap ../Minimum-Heap/minheap.c graph.c prim.c prim-main.c -lm -o prim-main
+
+## File
+
+- [prim.c](prim.c)
+- [prim.h](prim.h)
+- [graph.c](graph.c)
+- [graph.h](graph.h)
+- [prim-main.c](prim-main.c)
+- [prim.in](prim.in)
+
+***/
+
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+#include "prim.h"
+#include "minheap.h"
+
+double prim_heap(const Graph *g, int *pred, double *key)
+{
+    MinHeap *h;
+    double *k = key;
+    char *done;
+    int r, u, v, j;
+    double total = 0.0;
+
+    assert(g != NULL);
+    assert(pred != NULL);
+
+    if (k == NULL) {
+        k = (double*)malloc(g->n * sizeof(*k));
+        assert(k != NULL);
+    }
+    done = (char*)calloc(g->n, 1);
+    assert(done != NULL);
+    for (v=0; v<g->n; v++) {
+        k[v] = HUGE_VAL;
+        pred[v] = -1;
+    }
+    h = minheap_create(g->n);
+    for (r=0; r<g->n; r++) {
+        if (done[r])
+            continue;
+        /* r è la radice di un nuovo albero della foresta */
+        k[r] = 0.0;
+        minheap_insert(h, r, 0.0);
+        while (!minheap_is_empty(h)) {
+            u = minheap_delete_min(h);
+            done[u] = 1;
+            total += k[u];
+            for (j=g->offset[u]; j<g->offset[u+1]; j++) {
+                v = g->dst[j];
+                if (!done[v] && g->w[j] < k[v]) {
+                    if (k[v] == HUGE_VAL) {
+                        minheap_insert(h, v, g->w[j]);
+                    } else {
+                        minheap_change_prio(h, v, g->w[j]);
+                    }
+                    k[v] = g->w[j];
+                    pred[v] = u;
+                }
+            }
+        }
+    }
+    minheap_destroy(h);
+    free(done);
+    if (key == NULL)
+        free(k);
+    return total;
+}
+
+double prim_dense(const Graph *g, int *pred, double *key)
+{
+    /* I nodi non ancora inclusi sono rest[0..nrest-1]; restkey[i] è
+       il peso dell'arco più leggero che collega rest[i] alla foresta,
+       e pos[v] è la posizione di v in rest[] (-1 se v è già
+       incluso) */
+    int *rest, *pos;
+    double *restkey;
+    int nrest, i, best, u, v, j;
+    double total = 0.0;
+
+    assert(g != NULL);
+    assert(pred != NULL);
+
+    rest = (int*)malloc(g->n * sizeof(*rest));
+    pos = (int*)malloc(g->n * sizeof(*pos));
+    restkey = (double*)malloc(g->n * sizeof(*restkey));
+    assert(rest != NULL && pos != NULL && restkey != NULL);
+    for (v=0; v<g->n; v++) {
+        rest[v] = v;
+        pos[v] = v;
+        restkey[v] = HUGE_VAL;
+        pred[v] = -1;
+    }
+    for (nrest=g->n; nrest>0; nrest--) {
+        best = 0;
+        for (i=1; i<nrest; i++) {
+            if (restkey[i] < restkey[best])
+                best = i;
+        }
+        u = rest[best];
+        if (restkey[best] == HUGE_VAL) {
+            /* nessun nodo è collegato alla foresta: u è la radice di
+               un nuovo albero */
+            restkey[best] = 0.0;
+        }
+        total += restkey[best];
+        if (key != NULL)
+            key[u] = restkey[best];
+        /* rimozione di u: l'ultimo nodo ne prende il posto */
+        rest[best] = rest[nrest-1];
+        restkey[best] = restkey[nrest-1];
+        pos[rest[best]] = best;
+        pos[u] = -1;
+        for (j=g->offset[u]; j<g->offset[u+1]; j++) {
+            v = g->dst[j];
+            if (pos[v] >= 0 && g->w[j] < restkey[pos[v]]) {
+                restkey[pos[v]] = g->w[j];
+                pred[v] = u;
+            }
+        }
+    }
+    free(rest);
+    free(pos);
+    free(restkey);
+    return total;
+}
+
+double prim(const Graph *g, int *pred, double *key)
+{
+    assert(g != NULL);
+
+    if ((double)g->m >= (double)g->n * g->n / PRIM_DENSE_RATIO)
+        return prim_dense(g, pred, key);
+    else
+        return prim_heap(g, pred, key);
+}
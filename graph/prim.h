@@ -0,0 +1,62 @@
+/****************************************************************************
+ *
+ * prim.h -- Interfaccia algoritmo di Prim
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef PRIM_H
+#define PRIM_H
+
+#include "graph.h"
+
+/* `prim()` usa la versione con array (`prim_dense()`) quando
+   m >= n*n / PRIM_DENSE_RATIO, e la versione con heap
+   (`prim_heap()`) altrimenti. Con pesi casuali le riduzioni di
+   priorità sono rare e `prim_heap()` è competitiva anche su grafi
+   completi; la versione con array evita però il caso pessimo in cui
+   quasi ogni arco esaminato riduce la priorità di un nodo. */
+#define PRIM_DENSE_RATIO 2
+
+/* Calcola una foresta ricoprente di peso minimo del grafo non
+   orientato `g`, e ne restituisce il peso complessivo. Al termine,
+   per ogni nodo v, pred[v] è il padre di v nella foresta (-1 se v è
+   una radice, cioè il primo nodo visitato della propria componente
+   connessa) e, se `key` non è NULL, key[v] è il peso dell'arco
+   (pred[v], v) (0 per le radici). Se il grafo è connesso la foresta
+   è un albero, la cui radice è il nodo 0.
+
+   Sceglie automaticamente tra `prim_heap()` e `prim_dense()` in base
+   alla densità del grafo.
+
+   Precondizioni:
+   - ogni arco (u, v) di peso w compare anche come (v, u) con lo
+     stesso peso (si veda `graph_undirected()`);
+   - pred[] (e key[], se non è NULL) hanno g->n elementi. */
+double prim(const Graph *g, int *pred, double *key);
+
+/* Come `prim()`, usando un `MinHeap` che contiene i nodi non ancora
+   inclusi nella foresta; costo O((n + m) log n). */
+double prim_heap(const Graph *g, int *pred, double *key);
+
+/* Come `prim()`, individuando ad ogni passo il nodo più vicino alla
+   foresta con una scansione di tutti i nodi non ancora inclusi;
+   costo O(n^2 + m), che per grafi densi (m vicino a n^2) è
+   inferiore a quello di `prim_heap()`. */
+double prim_dense(const Graph *g, int *pred, double *key);
+
+#endif
@@ -0,0 +1,190 @@
+/****************************************************************************
+ *
+ * incremental-sort.c -- Incremental Quicksort
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Incremental Quicksort
+% Ultimo aggiornamento: 2026-10-19
+
+_Incremental Quicksort_ (IQS, Paredes e Navarro, 2006) restituisce
+gli elementi di un array in ordine crescente uno alla volta,
+eseguendo solo il lavoro di partizionamento necessario per
+determinare il prossimo elemento. È utile quando non si sa in
+anticipo quanti elementi serviranno: ordinare tutto l'array costa
+$\Theta(n \log n)$ anche se servono solo i primi elementi, mentre una
+selezione parziale richiede di conoscere $k$ in anticipo.
+
+L'algoritmo mantiene uno stack di posizioni di pivot, in ordine
+decrescente dalla base alla cima; inizialmente lo stack contiene solo
+$n$ (una sentinella). Per estrarre l'elemento di indice `next`:
+
+- se la cima dello stack è `next`, l'elemento `v[next]` è un pivot
+  già nella sua posizione finale: si rimuove dallo stack e lo si
+  restituisce;
+
+- altrimenti si partiziona `v[next..top-1]` attorno ad un pivot, si
+  inserisce nello stack la posizione finale del pivot e si ripete.
+
+Quando il segmento da partizionare è piccolo conviene ordinarlo
+completamente con Insertion Sort. Il costo per estrarre i primi $k$
+elementi è $O(n + k \log k)$ nel caso medio.
+
+## File
+
+- [incremental-sort.c](incremental-sort.c)
+- [incremental-sort.h](incremental-sort.h)
+
+***/
+
+#include <stdlib.h>
+#include <assert.h>
+#include "incremental-sort.h"
+
+/* Segmenti di lunghezza inferiore vengono ordinati con Insertion
+   Sort anziché partizionati */
+#define INCSORT_CUTOFF 16
+
+IncSort *incsort_create(int *v, int n)
+{
+    IncSort *s = (IncSort*)malloc(sizeof(*s));
+    assert(s != NULL);
+    assert(n >= 0);
+    assert(v != NULL || n == 0);
+
+    s->v = v;
+    s->n = n;
+    s->next = s->sorted_end = 0;
+    s->capacity = 64;
+    s->stack = (int*)malloc(s->capacity * sizeof(*(s->stack)));
+    assert(s->stack != NULL);
+    s->stack[0] = n; /* sentinella */
+    s->top = 1;
+    return s;
+}
+
+void incsort_destroy(IncSort *s)
+{
+    assert(s != NULL);
+
+    free(s->stack);
+    free(s);
+}
+
+int incsort_has_next(const IncSort *s)
+{
+    assert(s != NULL);
+
+    return (s->next < s->n);
+}
+
+static void swap(int *v, int i, int j)
+{
+    const int tmp = v[i];
+    v[i] = v[j];
+    v[j] = tmp;
+}
+
+static void push(IncSort *s, int i)
+{
+    if (s->top == s->capacity) {
+        s->capacity *= 2;
+        s->stack = (int*)realloc(s->stack, s->capacity * sizeof(*(s->stack)));
+        assert(s->stack != NULL);
+    }
+    s->stack[s->top++] = i;
+}
+
+/* Ordina v[lo..hi] (estremi inclusi) con Insertion Sort */
+static void insertion_sort(int *v, int lo, int hi)
+{
+    int i, j;
+    for (i=lo+1; i<=hi; i++) {
+        const int x = v[i];
+        for (j=i; j>lo && v[j-1] > x; j--) {
+            v[j] = v[j-1];
+        }
+        v[j] = x;
+    }
+}
+
+/* Partiziona v[lo..hi] (estremi inclusi, hi - lo >= 2) attorno al
+   mediano tra primo, ultimo ed elemento centrale, e restituisce la
+   posizione finale del pivot. Gli elementi uguali al pivot vengono
+   distribuiti su entrambi i lati, per cui anche array con molti
+   duplicati vengono divisi in parti bilanciate. */
+static int partition(int *v, int lo, int hi)
+{
+    const int mid = lo + (hi - lo)/2;
+    int i, j, pivot;
+
+    /* Dopo questi scambi v[lo] <= v[hi-1] <= v[hi]; v[lo] e v[hi]
+       fanno da sentinelle */
+    if (v[mid] < v[lo]) swap(v, mid, lo);
+    if (v[hi] < v[lo]) swap(v, hi, lo);
+    if (v[hi] < v[mid]) swap(v, hi, mid);
+    swap(v, mid, hi-1);
+    pivot = v[hi-1];
+
+    i = lo;
+    j = hi-1;
+    for (;;) {
+        do { i++; } while (v[i] < pivot);
+        do { j--; } while (pivot < v[j]);
+        if (i >= j)
+            break;
+        swap(v, i, j);
+    }
+    swap(v, i, hi-1);
+    return i;
+}
+
+int incsort_next(IncSort *s)
+{
+    assert(incsort_has_next(s));
+
+    while (s->next >= s->sorted_end) {
+        const int top = s->stack[s->top - 1];
+        if (top == s->next) {
+            s->top--;
+            s->sorted_end = s->next + 1;
+        } else if (top - s->next <= INCSORT_CUTOFF) {
+            /* Il pivot `top` resta sullo stack: verrà rimosso
+               quando `next` lo raggiunge */
+            insertion_sort(s->v, s->next, top - 1);
+            s->sorted_end = top;
+        } else {
+            push(s, partition(s->v, s->next, top - 1));
+        }
+    }
+    return s->v[s->next++];
+}
+
+int incsort_next_k(IncSort *s, int *out, int k)
+{
+    int i;
+
+    assert(s != NULL);
+    assert(k >= 0);
+
+    for (i=0; i<k && incsort_has_next(s); i++) {
+        out[i] = incsort_next(s);
+    }
+    return i;
+}
@@ -0,0 +1,58 @@
+/****************************************************************************
+ *
+ * incremental-sort.h -- Interfaccia Incremental Quicksort
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef INCREMENTAL_SORT_H
+#define INCREMENTAL_SORT_H
+
+typedef struct {
+    int *v;          /* array da ordinare (non è una copia) */
+    int n;           /* lunghezza di v[] */
+    int next;        /* indice del prossimo elemento da restituire */
+    int sorted_end;  /* v[next..sorted_end-1] sono già in posizione finale */
+    int *stack;      /* indici dei pivot ancora da raggiungere */
+    int top;         /* numero di elementi in stack[] */
+    int capacity;    /* dimensione di stack[] */
+} IncSort;
+
+/* Crea un ordinatore incrementale per l'array v[] di lunghezza
+   n>=0. L'array viene permutato "sul posto" man mano che si
+   estraggono gli elementi: in ogni momento v[0..k-1] contiene, in
+   ordine crescente, i k elementi già restituiti. v[] non deve essere
+   modificato dal chiamante finché l'ordinatore è in uso. */
+IncSort *incsort_create(int *v, int n);
+
+/* Dealloca l'ordinatore; non dealloca v[] */
+void incsort_destroy(IncSort *s);
+
+/* Restituisce 1 se e solo se ci sono ancora elementi da restituire */
+int incsort_has_next(const IncSort *s);
+
+/* Restituisce il minimo tra gli elementi non ancora restituiti.
+   Restituire i primi k elementi costa O(n + k log k) in media.
+
+   Precondizione: incsort_has_next(s) */
+int incsort_next(IncSort *s);
+
+/* Copia in out[] i prossimi (al più) k elementi in ordine crescente,
+   e restituisce il numero di elementi copiati. */
+int incsort_next_k(IncSort *s, int *out, int k);
+
+#endif
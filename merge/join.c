@@ -0,0 +1,255 @@
+/****************************************************************************
+ *
+ * join.c -- Sort-merge join
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Sort-merge join
+% Ultimo aggiornamento: 2026-10-19
+
+Date due relazioni, cioè due sequenze di coppie (chiave, valore), il
+_join_ per uguaglianza produce tutte le coppie di elementi, uno per
+relazione, che hanno la stessa chiave. Il _sort-merge join_ ordina le
+due relazioni per chiave e poi le scandisce in parallelo, come nella
+procedura `merge()` di Merge Sort: si avanza nella relazione la cui
+chiave corrente è minore; quando le chiavi correnti coincidono, si
+individuano le sequenze di elementi con quella chiave in entrambe le
+relazioni e se ne produce il prodotto cartesiano.
+
+A differenza dell'_hash join_ non serve una tabella hash: la memoria
+aggiuntiva è solo quella del buffer usato da Merge Sort.
+
+Nella versione parallela l'insieme delle chiavi viene diviso in $p$
+intervalli disgiunti, i cui estremi sono scelti ordinando un campione
+delle chiavi di entrambe le relazioni. Gli elementi di ciascuna
+relazione vengono distribuiti tra gli intervalli, e ogni thread
+esegue il sort-merge join di un intervallo in modo indipendente dagli
+altri: elementi con la stessa chiave appartengono sempre allo stesso
+intervallo.
+
+Per compilare è necessario il supporto ai thread POSIX (`-pthread`).
+
+## File
+
+- [join.c](join.c)
+- [join.h](join.h)
+
+***/
+
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+#include "join.h"
+#include "merge-sort.h"
+
+/* Numero di chiavi campionate per ciascun intervallo, per scegliere
+   gli estremi degli intervalli nella versione parallela */
+#define JOIN_SAMPLES_PER_PART 64
+
+/* Fonde le relazioni (lk, lp) e (rk, rp), già ordinate per chiave,
+   invocando `emit` per ogni coppia con chiavi uguali. Restituisce il
+   numero di coppie prodotte. */
+static int64_t merge_join(const int *lk, const int *lp, int nl,
+                          const int *rk, const int *rp, int nr,
+                          JoinEmit emit, void *arg, int part)
+{
+    int i = 0, j = 0, ie, je, a, b;
+    int64_t count = 0;
+
+    while (i<nl && j<nr) {
+        if (lk[i] < rk[j]) {
+            i++;
+        } else if (lk[i] > rk[j]) {
+            j++;
+        } else {
+            const int key = lk[i];
+            for (ie=i+1; ie<nl && lk[ie] == key; ie++)
+                ;
+            for (je=j+1; je<nr && rk[je] == key; je++)
+                ;
+            count += (int64_t)(ie - i) * (je - j);
+            if (emit != NULL) {
+                for (a=i; a<ie; a++) {
+                    for (b=j; b<je; b++) {
+                        emit(key, lp[a], rp[b], part, arg);
+                    }
+                }
+            }
+            i = ie;
+            j = je;
+        }
+    }
+    return count;
+}
+
+int64_t sort_merge_join(int *lkey, int *lpay, int nl,
+                        int *rkey, int *rpay, int nr,
+                        JoinEmit emit, void *arg)
+{
+    assert(nl >= 0 && nr >= 0);
+
+    sort_pairs(lkey, lpay, nl);
+    sort_pairs(rkey, rpay, nr);
+    return merge_join(lkey, lpay, nl, rkey, rpay, nr, emit, arg, 0);
+}
+
+/* Lavoro assegnato ad un thread: una partizione di ciascuna
+   relazione */
+typedef struct {
+    int *lk, *lp, nl;
+    int *rk, *rp, nr;
+    int part;
+    JoinEmit emit;
+    void *arg;
+    int64_t count;
+} JoinTask;
+
+static void *join_worker(void *p)
+{
+    JoinTask *t = (JoinTask*)p;
+
+    sort_pairs(t->lk, t->lp, t->nl);
+    sort_pairs(t->rk, t->rp, t->nr);
+    t->count = merge_join(t->lk, t->lp, t->nl, t->rk, t->rp, t->nr,
+                          t->emit, t->arg, t->part);
+    return NULL;
+}
+
+/* Restituisce l'indice dell'intervallo cui appartiene `key`, cioè il
+   numero di estremi splitter[0..nsplit-1] minori o uguali a `key` */
+static int part_of(const int *splitter, int nsplit, int key)
+{
+    int lo = 0, hi = nsplit;
+
+    while (lo < hi) {
+        const int mid = lo + (hi - lo)/2;
+        if (splitter[mid] <= key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/* Distribuisce la relazione (key, pay) di lunghezza n tra le `nparts`
+   partizioni definite da splitter[], copiandola in (okey, opay);
+   start[t] è l'indice del primo elemento della partizione t, e
+   start[nparts] = n. */
+static void partition_rel(const int *key, const int *pay, int n,
+                          const int *splitter, int nparts,
+                          int *okey, int *opay, int *start)
+{
+    int *next = (int*)calloc(nparts + 1, sizeof(*next));
+    int i, t;
+
+    assert(next != NULL);
+    for (i=0; i<n; i++) {
+        next[part_of(splitter, nparts-1, key[i]) + 1]++;
+    }
+    for (t=0; t<nparts; t++) {
+        next[t+1] += next[t];
+    }
+    for (t=0; t<=nparts; t++) {
+        start[t] = next[t];
+    }
+    for (i=0; i<n; i++) {
+        const int k = next[part_of(splitter, nparts-1, key[i])]++;
+        okey[k] = key[i];
+        opay[k] = pay[i];
+    }
+    free(next);
+}
+
+int64_t sort_merge_join_parallel(const int *lkey, const int *lpay, int nl,
+                                 const int *rkey, const int *rpay, int nr,
+                                 int nthreads, JoinEmit emit, void *arg)
+{
+    int *sample, *splitter, *lstart, *rstart, *mem;
+    int *lk, *lp, *rk, *rp;
+    JoinTask *task;
+    pthread_t *tid;
+    int nsample, i, t;
+    int64_t count = 0;
+
+    assert(nl >= 0 && nr >= 0);
+    assert(nthreads >= 1);
+
+    /* Scelta degli estremi degli intervalli: un campione di chiavi
+       prese ad intervalli regolari da entrambe le relazioni viene
+       ordinato e suddiviso in `nthreads` parti uguali */
+    nsample = JOIN_SAMPLES_PER_PART * nthreads;
+    if (nsample > nl + nr)
+        nsample = nl + nr;
+    sample = (int*)malloc((nsample + nthreads) * sizeof(*sample));
+    assert(sample != NULL);
+    splitter = sample + nsample;
+    for (i=0; i<nsample; i++) {
+        const int64_t j = (int64_t)i * (nl + nr) / nsample;
+        sample[i] = (j < nl ? lkey[j] : rkey[j - nl]);
+    }
+    sort(sample, nsample);
+    for (t=0; t<nthreads-1; t++) {
+        splitter[t] = (nsample > 0 ? sample[(int64_t)(t+1) * nsample / nthreads] : 0);
+    }
+
+    mem = (int*)malloc(2 * ((nl + nr) > 0 ? (nl + nr) : 1) * sizeof(*mem));
+    lstart = (int*)malloc(2 * (nthreads + 1) * sizeof(*lstart));
+    task = (JoinTask*)malloc(nthreads * sizeof(*task));
+    tid = (pthread_t*)malloc(nthreads * sizeof(*tid));
+    assert(mem != NULL && lstart != NULL && task != NULL && tid != NULL);
+    rstart = lstart + nthreads + 1;
+    lk = mem;
+    lp = lk + nl;
+    rk = lp + nl;
+    rp = rk + nr;
+    partition_rel(lkey, lpay, nl, splitter, nthreads, lk, lp, lstart);
+    partition_rel(rkey, rpay, nr, splitter, nthreads, rk, rp, rstart);
+
+    for (t=0; t<nthreads; t++) {
+        task[t].lk = lk + lstart[t];
+        task[t].lp = lp + lstart[t];
+        task[t].nl = lstart[t+1] - lstart[t];
+        task[t].rk = rk + rstart[t];
+        task[t].rp = rp + rstart[t];
+        task[t].nr = rstart[t+1] - rstart[t];
+        task[t].part = t;
+        task[t].emit = emit;
+        task[t].arg = arg;
+        task[t].count = 0;
+        if (pthread_create(&tid[t], NULL, join_worker, &task[t]) != 0) {
+            /* se non è possibile creare il thread, la partizione
+               viene elaborata dal thread chiamante */
+            join_worker(&task[t]);
+            tid[t] = pthread_self();
+        }
+    }
+    for (t=0; t<nthreads; t++) {
+        if (!pthread_equal(tid[t], pthread_self())) {
+            pthread_join(tid[t], NULL);
+        }
+        count += task[t].count;
+    }
+
+    free(sample);
+    free(mem);
+    free(lstart);
+    free(task);
+    free(tid);
+    return count;
+}
@@ -0,0 +1,62 @@
+/****************************************************************************
+ *
+ * join.h -- Interfaccia Sort-merge join
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef JOIN_H
+#define JOIN_H
+
+#include <stdint.h>
+
+/* Funzione invocata per ogni coppia del risultato del join: `key` è
+   la chiave comune, `lpay` e `rpay` i valori associati nei due
+   input. `part` indica la partizione che ha prodotto la coppia (0
+   nella versione sequenziale); tutte le coppie con lo stesso valore
+   di `part` vengono prodotte dallo stesso thread. `arg` è il
+   puntatore passato a `sort_merge_join()` o
+   `sort_merge_join_parallel()`. */
+typedef void (*JoinEmit)(int key, int lpay, int rpay, int part, void *arg);
+
+/* Calcola il join per uguaglianza di chiave tra le relazioni
+   (lkey[i], lpay[i]), i = 0..nl-1, e (rkey[j], rpay[j]), j =
+   0..nr-1: per ogni coppia (i, j) con lkey[i] == rkey[j] invoca
+   `emit(lkey[i], lpay[i], rpay[j], 0, arg)`. Le coppie vengono
+   prodotte in ordine non decrescente di chiave; `emit` può essere
+   NULL se interessa solo il numero di coppie.
+
+   Le due relazioni vengono ordinate sul posto per chiave con
+   `sort_pairs()`. Restituisce il numero di coppie prodotte. */
+int64_t sort_merge_join(int *lkey, int *lpay, int nl,
+                        int *rkey, int *rpay, int nr,
+                        JoinEmit emit, void *arg);
+
+/* Come `sort_merge_join()`, ma usa `nthreads` thread: l'insieme delle
+   chiavi viene diviso in `nthreads` intervalli disgiunti, e ciascun
+   thread ordina e fonde le coppie di un intervallo. `emit` viene
+   quindi invocata in modo concorrente con valori di `part` diversi;
+   l'ordine delle coppie è non decrescente solo all'interno della
+   stessa partizione.
+
+   Gli input non vengono modificati: le partizioni sono copie, per
+   cui la memoria aggiuntiva è proporzionale a nl + nr. */
+int64_t sort_merge_join_parallel(const int *lkey, const int *lpay, int nl,
+                                 const int *rkey, const int *rpay, int nr,
+                                 int nthreads, JoinEmit emit, void *arg);
+
+#endif
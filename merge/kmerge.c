@@ -0,0 +1,311 @@
+/****************************************************************************
+ *
+ * kmerge.c -- Fusione di k sequenze ordinate
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Fusione di k sequenze ordinate
+% Ultimo aggiornamento: 2026-10-19
+
+La procedura `merge()` di Merge Sort fonde due sequenze ordinate;
+per fondere $k$ sequenze (_run_), ad esempio le parti di un archivio
+ordinate separatamente, si sceglie ad ogni passo la sequenza il cui
+prossimo valore è minimo, lo si scrive nel risultato e si avanza in
+quella sequenza. Con una scansione delle $k$ sequenze il costo per
+valore sarebbe $O(k)$; sono disponibili due strutture che lo riducono
+a $O(\log k)$:
+
+- `KMERGE_HEAP` usa un `MinHeap` in cui la chiave è l'indice della
+  sequenza e la priorità il suo prossimo valore. Dopo aver scritto il
+  minimo, la priorità della stessa sequenza viene aggiornata con
+  `minheap_change_prio()`, cioè con una discesa nello heap, che
+  richiede fino a due confronti per livello (per individuare il
+  figlio minore, e per confrontarlo con l'elemento che scende);
+
+- `KMERGE_LOSER_TREE` usa un _albero dei perdenti_ (_loser tree_,
+  o albero del torneo): un albero binario completo con le $k$
+  sequenze come foglie, in cui ogni nodo interno memorizza la
+  sequenza che ha _perso_ il confronto in quel nodo, e la radice il
+  vincitore complessivo. Dopo aver scritto il valore del vincitore,
+  si risale dalla sua foglia alla radice confrontando il nuovo valore
+  solo con il perdente memorizzato in ciascun nodo: un confronto per
+  livello, senza dover esaminare i fratelli.
+
+In entrambi i casi il prossimo valore di ciascuna sequenza è copiato
+in un array (nello heap, o in `head[]` per l'albero dei perdenti),
+per evitare di accedere ai buffer di input durante i confronti.
+
+Per fondere file, ciascuna sequenza viene letta a blocchi di
+`KMERGE_BLOCK` interi con `fread()`, e il risultato viene accumulato
+in un buffer della stessa dimensione e scritto con `fwrite()`; per
+gli array, invece, il risultato viene scritto direttamente
+nell'array di destinazione.
+
+Per compilare è necessario `minheap.c` (nella directory
+`../Minimum-Heap`); si veda [mergeruns.c](mergeruns.c).
+
+## File
+
+- [kmerge.c](kmerge.c)
+- [kmerge.h](kmerge.h)
+- [mergeruns.c](mergeruns.c)
+
+***/
+
+#include <stdlib.h>
+#include <math.h>
+#include <assert.h>
+#include "kmerge.h"
+#include "minheap.h"
+
+/* Una sequenza da fondere: i valori non ancora fusi sono
+   buf[pos..nbuf-1], seguiti (se f != NULL) dal resto del file f */
+typedef struct {
+    const int *buf;
+    int pos, nbuf;
+    FILE *f; /* NULL per gli array, o quando il file è terminato */
+    int *mem; /* buffer di lettura, NULL per gli array */
+    int err; /* != 0 in caso di errore di lettura */
+} KRun;
+
+/* Destinazione del risultato: i valori vengono accumulati in
+   buf[0..len-1] e, se f != NULL, scritti su file quando il buffer è
+   pieno */
+typedef struct {
+    int *buf;
+    long len, cap;
+    long total; /* numero di valori prodotti */
+    FILE *f;
+    int err; /* != 0 in caso di errore di scrittura */
+} KOut;
+
+/* Funzione di supporto: legge il blocco successivo del file della
+   sequenza `r` */
+static void run_fill(KRun *r)
+{
+    const size_t nbytes = fread(r->mem, 1, KMERGE_BLOCK * sizeof(int), r->f);
+
+    r->buf = r->mem;
+    r->pos = 0;
+    r->nbuf = (int)(nbytes / sizeof(int));
+    if (nbytes < KMERGE_BLOCK * sizeof(int)) {
+        /* fine del file; un file la cui lunghezza non è multipla di
+           sizeof(int) è considerato un errore */
+        r->err = (ferror(r->f) || nbytes % sizeof(int) != 0);
+        r->f = NULL;
+    }
+}
+
+/* Funzione di supporto: avanza al prossimo valore della sequenza
+   `r`, che non deve essere esaurita */
+static void run_advance(KRun *r)
+{
+    r->pos++;
+    if (r->pos == r->nbuf && r->f != NULL) {
+        run_fill(r);
+    }
+}
+
+static void out_flush(KOut *o)
+{
+    if (o->f != NULL && o->len > 0) {
+        if (fwrite(o->buf, sizeof(int), o->len, o->f) != (size_t)o->len) {
+            o->err = 1;
+        }
+        o->len = 0;
+    }
+}
+
+static void out_put(KOut *o, int x)
+{
+    if (o->len == o->cap) {
+        out_flush(o);
+    }
+    o->buf[o->len++] = x;
+    o->total++;
+}
+
+static void merge_heap(KRun *run, int k, KOut *out)
+{
+    MinHeap *h = minheap_create(k > 0 ? k : 1);
+    KRun *r;
+    int s;
+
+    for (s=0; s<k; s++) {
+        if (run[s].pos < run[s].nbuf) {
+            minheap_insert(h, s, run[s].buf[run[s].pos]);
+        }
+    }
+    while (!minheap_is_empty(h)) {
+        s = minheap_min(h);
+        r = &run[s];
+        out_put(out, r->buf[r->pos]);
+        run_advance(r);
+        if (r->pos < r->nbuf) {
+            minheap_change_prio(h, s, r->buf[r->pos]);
+        } else {
+            minheap_delete_min(h);
+        }
+    }
+    minheap_destroy(h);
+}
+
+/* Albero dei perdenti con K foglie, K potenza di due >= k. I nodi
+   interni sono 1 .. K-1, con figli 2i e 2i+1; la foglia della
+   sequenza s è il nodo K + s. tree[i] è il perdente del confronto nel
+   nodo i, tree[0] il vincitore. head[s] è il prossimo valore della
+   sequenza s, oppure HUGE_VAL se la sequenza è esaurita (o la foglia
+   non è usata): poiché ogni `int` è rappresentabile esattamente come
+   `double`, le sequenze esaurite seguono tutte le altre senza
+   bisogno di confronti aggiuntivi. */
+typedef struct {
+    int K;
+    int *tree;
+    double *head;
+} LoserTree;
+
+static void merge_loser_tree(KRun *run, int k, KOut *out)
+{
+    LoserTree t;
+    int *winner;
+    int i, s, w, node;
+    double x;
+    KRun *r;
+
+    for (t.K = 1; t.K < k; t.K *= 2)
+        ;
+    t.tree = (int*)malloc(t.K * sizeof(*(t.tree)));
+    t.head = (double*)malloc(t.K * sizeof(*(t.head)));
+    winner = (int*)malloc(2 * t.K * sizeof(*winner));
+    assert(t.tree != NULL && t.head != NULL && winner != NULL);
+
+    for (s=0; s<t.K; s++) {
+        t.head[s] = (s < k && run[s].pos < run[s].nbuf ? run[s].buf[run[s].pos] : HUGE_VAL);
+        winner[t.K + s] = s;
+    }
+    for (i=t.K-1; i>=1; i--) {
+        const int a = winner[2*i], b = winner[2*i+1];
+        if (t.head[b] < t.head[a]) {
+            winner[i] = b;
+            t.tree[i] = a;
+        } else {
+            winner[i] = a;
+            t.tree[i] = b;
+        }
+    }
+    t.tree[0] = winner[1];
+    free(winner);
+
+    while (t.head[w = t.tree[0]] != HUGE_VAL) {
+        r = &run[w];
+        out_put(out, r->buf[r->pos]);
+        run_advance(r);
+        t.head[w] = (r->pos < r->nbuf ? r->buf[r->pos] : HUGE_VAL);
+        x = t.head[w];
+        for (node = (t.K + w) / 2; node >= 1; node /= 2) {
+            /* scritto senza salti condizionali: con valori casuali
+               l'esito del confronto è imprevedibile */
+            const int other = t.tree[node];
+            const int swap = (t.head[other] < x);
+            t.tree[node] = (swap ? w : other);
+            w = (swap ? other : w);
+            x = (swap ? t.head[other] : x);
+        }
+        t.tree[0] = w;
+    }
+    free(t.tree);
+    free(t.head);
+}
+
+static void merge_runs(KRun *run, int k, KOut *out, KMergeEngine engine)
+{
+    if (engine == KMERGE_HEAP) {
+        merge_heap(run, k, out);
+    } else {
+        merge_loser_tree(run, k, out);
+    }
+}
+
+void kmerge_arrays(const int **v, const int *n, int k, int *out, KMergeEngine engine)
+{
+    KRun *run = (KRun*)malloc((k > 0 ? k : 1) * sizeof(*run));
+    KOut o;
+    long total = 0;
+    int s;
+
+    assert(run != NULL);
+    assert(k >= 0);
+
+    for (s=0; s<k; s++) {
+        assert(n[s] >= 0);
+        run[s].buf = v[s];
+        run[s].pos = 0;
+        run[s].nbuf = n[s];
+        run[s].f = NULL;
+        run[s].mem = NULL;
+        run[s].err = 0;
+        total += n[s];
+    }
+    o.buf = out;
+    o.len = 0;
+    o.total = 0;
+    o.cap = total;
+    o.f = NULL;
+    o.err = 0;
+    merge_runs(run, k, &o, engine);
+    assert(o.len == total);
+    free(run);
+}
+
+long kmerge_files(FILE **in, int k, FILE *out, KMergeEngine engine)
+{
+    KRun *run = (KRun*)malloc((k > 0 ? k : 1) * sizeof(*run));
+    KOut o;
+    int s, err;
+
+    assert(run != NULL);
+    assert(k >= 0);
+    assert(out != NULL);
+
+    for (s=0; s<k; s++) {
+        run[s].f = in[s];
+        run[s].mem = (int*)malloc(KMERGE_BLOCK * sizeof(int));
+        assert(run[s].mem != NULL);
+        run[s].err = 0;
+        run_fill(&run[s]);
+    }
+    o.buf = (int*)malloc(KMERGE_BLOCK * sizeof(int));
+    assert(o.buf != NULL);
+    o.len = 0;
+    o.total = 0;
+    o.cap = KMERGE_BLOCK;
+    o.f = out;
+    o.err = 0;
+    merge_runs(run, k, &o, engine);
+
+    out_flush(&o);
+    err = o.err;
+    for (s=0; s<k; s++) {
+        err = err || run[s].err;
+        free(run[s].mem);
+    }
+    free(o.buf);
+    free(run);
+    return (err ? -1 : o.total);
+}
@@ -0,0 +1,59 @@
+/****************************************************************************
+ *
+ * kmerge.h -- Interfaccia fusione di k sequenze ordinate
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef KMERGE_H
+#define KMERGE_H
+
+#include <stdio.h>
+
+/* Numero di valori letti o scritti con ciascuna chiamata a fread() o
+   fwrite() da `kmerge_files()`; può essere modificato in fase di
+   compilazione, ad esempio con -DKMERGE_BLOCK=4096. Ogni file di
+   input usa un buffer di KMERGE_BLOCK interi. */
+#ifndef KMERGE_BLOCK
+#define KMERGE_BLOCK 16384
+#endif
+
+/* Algoritmo usato per individuare, ad ogni passo, la sequenza il cui
+   prossimo valore è minimo */
+typedef enum {
+    KMERGE_HEAP, /* MinHeap con chiave = sequenza, prio = prossimo valore */
+    KMERGE_LOSER_TREE /* albero dei perdenti */
+} KMergeEngine;
+
+/* Fonde i k array ordinati in modo non decrescente v[0], ...,
+   v[k-1], dove v[i] ha lunghezza n[i], scrivendo il risultato in
+   out[], che deve avere lunghezza n[0] + ... + n[k-1].
+
+   Precondizione: k >= 0 */
+void kmerge_arrays(const int **v, const int *n, int k, int *out, KMergeEngine engine);
+
+/* Fonde i k file in[0], ..., in[k-1], già aperti in lettura, che
+   contengono sequenze ordinate in modo non decrescente di `int`
+   nella rappresentazione interna della macchina, e scrive il
+   risultato nello stesso formato su `out`. Restituisce il numero di
+   valori scritti, oppure -1 in caso di errore di lettura o di
+   scrittura. I file non vengono chiusi.
+
+   Precondizione: k >= 0 */
+long kmerge_files(FILE **in, int k, FILE *out, KMergeEngine engine);
+
+#endif
@@ -0,0 +1,151 @@
+/****************************************************************************
+ *
+ * merge-sort-cxx-main.cpp -- Test e misure per merge-sort.hpp
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Compilare con:
+
+        g++ -std=c++11 -Wall -Wpedantic merge-sort-cxx-main.cpp -o merge-sort-cxx
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <functional>
+#include "merge-sort.hpp"
+
+static int compare(const void *p1, const void *p2)
+{
+    const int v1 = *static_cast<const int*>(p1);
+    const int v2 = *static_cast<const int*>(p2);
+    return (v1 > v2) - (v1 < v2);
+}
+
+static double elapsed_since(std::clock_t tstart)
+{
+    return static_cast<double>(std::clock() - tstart) / CLOCKS_PER_SEC;
+}
+
+static bool report(const char *name, bool ok)
+{
+    std::printf("Test %s %s\n", name, ok ? "OK" : "FALLITO");
+    return ok;
+}
+
+/* Confronta asd::merge_sort() con qsort() su n interi casuali */
+static bool test_int(int n)
+{
+    std::vector<int> v(n), ref;
+    for (int i = 0; i < n; i++)
+        v[i] = std::rand() % (n + 1) - n/2;
+    ref = v;
+
+    std::clock_t tstart = std::clock();
+    std::qsort(ref.data(), ref.size(), sizeof(int), compare);
+    const double t_qsort = elapsed_since(tstart);
+    tstart = std::clock();
+    asd::merge_sort(v);
+    const double t_merge = elapsed_since(tstart);
+
+    std::printf("n=%d qsort %f, asd::merge_sort %f seconds\n", n, t_qsort, t_merge);
+    return report("int", v == ref);
+}
+
+/* Ordinamento decrescente, e con un valore di Cutoff diverso */
+static bool test_compare(int n)
+{
+    std::vector<int> v(n), ref;
+    for (int i = 0; i < n; i++)
+        v[i] = std::rand();
+    ref = v;
+    std::sort(ref.begin(), ref.end(), std::greater<int>());
+    asd::merge_sort<int, std::greater<int>, 4>(v.data(), v.size());
+    return report("greater", v == ref);
+}
+
+/* Stringhe: tipo non banalmente copiabile */
+static bool test_string( void )
+{
+    const char *words[] = {"pera", "mela", "banana", "kiwi", "arancia",
+                           "fico", "ciliegia", "mela", "uva", "albicocca",
+                           "susina", "cachi", "melone", "anguria", "lampone",
+                           "mora", "ribes", "nespola", "dattero", "pesca"};
+    std::vector<std::string> v(words, words + sizeof(words)/sizeof(words[0]));
+    std::vector<std::string> ref(v);
+    std::sort(ref.begin(), ref.end());
+    asd::merge_sort(v);
+    return report("string", v == ref);
+}
+
+struct DerefLess {
+    bool operator()(const std::unique_ptr<int> &a, const std::unique_ptr<int> &b) const
+    {
+        return *a < *b;
+    }
+};
+
+/* Tipo che può essere solo spostato */
+static bool test_move_only(int n)
+{
+    std::vector< std::unique_ptr<int> > v;
+    for (int i = 0; i < n; i++)
+        v.push_back(std::unique_ptr<int>(new int(std::rand() % 1000)));
+    asd::merge_sort(v, DerefLess());
+    bool ok = true;
+    for (int i = 1; i < n; i++)
+        ok = ok && v[i] && *v[i-1] <= *v[i];
+    return report("unique_ptr", ok);
+}
+
+struct ByKey {
+    bool operator()(const std::pair<int, int> &a, const std::pair<int, int> &b) const
+    {
+        return a.first < b.first;
+    }
+};
+
+/* Stabilità: a parità di chiave si conserva l'ordine di input */
+static bool test_stable(int n)
+{
+    std::vector< std::pair<int, int> > v(n);
+    for (int i = 0; i < n; i++)
+        v[i] = std::make_pair(std::rand() % 10, i);
+    std::vector< std::pair<int, int> > ref(v);
+    std::stable_sort(ref.begin(), ref.end(), ByKey());
+    asd::merge_sort(v, ByKey());
+    return report("stable", v == ref);
+}
+
+int main( void )
+{
+    bool ok = true;
+    ok = test_int(0) && ok;
+    ok = test_int(1) && ok;
+    ok = test_int(17) && ok;
+    ok = test_int(1000000) && ok;
+    ok = test_compare(1000) && ok;
+    ok = test_string() && ok;
+    ok = test_move_only(1000) && ok;
+    ok = test_stable(10000) && ok;
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
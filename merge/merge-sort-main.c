@@ -0,0 +1,809 @@
+/****************************************************************************
+ *
+ * merge-sort-main.c -- Test e misure per Merge Sort
+ *
+ * Copyright (C) 2021--2025 Nicolas Farabegoli, Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <assert.h>
+#include <inttypes.h>
+#include <limits.h>
+#include "merge-sort.h"
+#include "radix-sort.h"
+#include "incremental-sort.h"
+#include "packed-set.h"
+#include "join.h"
+#include "kmerge.h"
+
+void print_array(const int *v, int n)
+{
+    int i;
+
+    printf("[ ");
+    for (i = 0; i < n; i++) {
+        printf("%d ", v[i]);
+    }
+    printf("]");
+}
+
+/* Restituisce un valore casuale compreso tra a e b (estremi inclusi) */
+int randab(int a, int b)
+{
+    return a + rand() % (b-a+1);
+}
+
+/* Permuta il contenuto dell'array v[] in modo casuale. Per fare
+   questo:
+
+   - Si scambia v[0] con uno elemento casuale scelto in v[0..n-1].
+
+   - Si scambia v[1] con un elemento casuale scelto in v[1..n-1].
+
+   - ...
+
+   - Si scambia v[i] con un elemento casuale scelto in v[i..n-1].
+
+   - ...
+
+   È possibile dimostrare che questo procedimento, applicato fino alla
+   fine, produce una permutazione casuale (random shuffle) di v[].
+*/
+void random_shuffle(int *v, int n)
+{
+    int i;
+
+    for (i=0; i<n-1; i++) {
+        const int j = randab(i, n-1);
+        const int tmp = v[i];
+        v[i] = v[j];
+        v[j] = tmp;
+    }
+}
+
+/* Restituisce un intero < 0 se *p1 è minore di *p2 (interpretati come
+   interi), 0 se sono uguali, > 0 se il primo è maggiore del
+   secondo. */
+int compare(const void *p1, const void *p2)
+{
+    const int v1 = *(const int*)p1;
+    const int v2 = *(const int*)p2;
+    if (v1 < v2)
+        return -1;
+    else if (v1 > v2)
+        return 1;
+    else
+        return 0;
+}
+
+/* Confronta il contenuto di due array v1 e v2 di lunghezza n;
+   restituisce l'indice del primo elemento il cui valore differisce
+   nei due array, oppure -1 se gli array hanno lo stesso contenuto */
+int compare_vec(const int *v1, const int *v2, int n)
+{
+    int i;
+    for (i=0; i<n; i++) {
+        if (v1[i] != v2[i])
+            return i;
+    }
+    return -1;
+}
+
+/* Ordina l'array v[] di lunghezza n. Confrontiamo il risultato
+   dell'ordinamento con quello prodotto dalla funzione qsort() della
+   libreria standard C. Restituisce true (nonzero) se il test ha
+   successo, 0 altrimenti. */
+int test(int *v, int n)
+{
+    int result;
+    int *tmp = (int*)malloc(n * sizeof(*tmp));
+    clock_t tstart, elapsed;
+    int diff;
+
+    assert(tmp != NULL); /* evita un warning con VS */
+    memcpy(tmp, v, n*sizeof(*v));
+    qsort(tmp, n, sizeof(*tmp), compare);
+    tstart = clock();
+    sort(v, n);
+    elapsed = clock() - tstart;
+    diff = compare_vec(v, tmp, n);
+    if (diff < 0) {
+        printf("Test OK (%f seconds)\n", ((double)elapsed) / CLOCKS_PER_SEC);
+        result = 1;
+    } else {
+        printf("Test FALLITO: v[%d]=%d, atteso=%d\n", diff, v[diff], tmp[diff]);
+        result = 0;
+    }
+    free(tmp);
+    return result;
+}
+
+int compare_int64(const void *p1, const void *p2)
+{
+    const int64_t v1 = *(const int64_t*)p1;
+    const int64_t v2 = *(const int64_t*)p2;
+    if (v1 < v2)
+        return -1;
+    else if (v1 > v2)
+        return 1;
+    else
+        return 0;
+}
+
+int compare_double(const void *p1, const void *p2)
+{
+    const double v1 = *(const double*)p1;
+    const double v2 = *(const double*)p2;
+    if (v1 < v2)
+        return -1;
+    else if (v1 > v2)
+        return 1;
+    else
+        return 0;
+}
+
+/* Restituisce un intero casuale a 64 bit; rand() produce almeno 15
+   bit casuali per volta. */
+int64_t rand64( void )
+{
+    uint64_t r = 0;
+    int i;
+    for (i=0; i<5; i++) {
+        r = (r << 15) ^ (uint64_t)(rand() & 0x7FFF);
+    }
+    return (int64_t)r;
+}
+
+/* Restituisce un valore reale casuale compreso tra -a e a */
+double rand_double(double a)
+{
+    return a * (2.0 * rand() / RAND_MAX - 1.0);
+}
+
+/* Restituisce un NaN con il bit di segno dato */
+double make_nan(int negative)
+{
+    uint64_t bits = ((uint64_t)0x7FF8) << 48;
+    double x;
+    if (negative)
+        bits |= ((uint64_t)1) << 63;
+    memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+static double elapsed_since(clock_t tstart)
+{
+    return ((double)(clock() - tstart)) / CLOCKS_PER_SEC;
+}
+
+/* Tempo reale trascorso (in secondi) da un istante fissato; a
+   differenza di clock(), che misura il tempo di CPU di tutti i
+   thread del processo, è adatto a misurare le versioni parallele */
+static double wall_time( void )
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1.0e9;
+}
+
+/* Ordina l'array v[] di n interi a 64 bit con `sort_int64()` e con
+   `radix_sort_int64()`, e confronta il risultato con quello prodotto
+   da qsort(). Restituisce true (nonzero) se il test ha successo. */
+int test_int64(const int64_t *v, int n)
+{
+    int64_t *ref = (int64_t*)malloc(n * sizeof(*ref));
+    int64_t *ms = (int64_t*)malloc(n * sizeof(*ms));
+    int64_t *rs = (int64_t*)malloc(n * sizeof(*rs));
+    clock_t tstart;
+    double t_qsort, t_merge, t_radix;
+    int i, result = 1;
+
+    assert(ref != NULL && ms != NULL && rs != NULL);
+    memcpy(ref, v, n*sizeof(*v));
+    memcpy(ms, v, n*sizeof(*v));
+    memcpy(rs, v, n*sizeof(*v));
+    tstart = clock();
+    qsort(ref, n, sizeof(*ref), compare_int64);
+    t_qsort = elapsed_since(tstart);
+    tstart = clock();
+    sort_int64(ms, n);
+    t_merge = elapsed_since(tstart);
+    tstart = clock();
+    radix_sort_int64(rs, n);
+    t_radix = elapsed_since(tstart);
+    for (i=0; i<n && result; i++) {
+        if (ms[i] != ref[i] || rs[i] != ref[i]) {
+            printf("Test int64 FALLITO: merge[%d]=%" PRId64 ", radix[%d]=%" PRId64 ", atteso=%" PRId64 "\n",
+                   i, ms[i], i, rs[i], ref[i]);
+            result = 0;
+        }
+    }
+    if (result) {
+        printf("Test int64 OK n=%d (qsort %f, merge %f, radix %f seconds)\n",
+               n, t_qsort, t_merge, t_radix);
+    }
+    free(ref);
+    free(ms);
+    free(rs);
+    return result;
+}
+
+/* Come `test_int64()`, per array di valori reali senza NaN */
+int test_double(const double *v, int n)
+{
+    double *ref = (double*)malloc(n * sizeof(*ref));
+    double *ms = (double*)malloc(n * sizeof(*ms));
+    double *rs = (double*)malloc(n * sizeof(*rs));
+    clock_t tstart;
+    double t_qsort, t_merge, t_radix;
+    int i, result = 1;
+
+    assert(ref != NULL && ms != NULL && rs != NULL);
+    memcpy(ref, v, n*sizeof(*v));
+    memcpy(ms, v, n*sizeof(*v));
+    memcpy(rs, v, n*sizeof(*v));
+    tstart = clock();
+    qsort(ref, n, sizeof(*ref), compare_double);
+    t_qsort = elapsed_since(tstart);
+    tstart = clock();
+    sort_double(ms, n);
+    t_merge = elapsed_since(tstart);
+    tstart = clock();
+    radix_sort_double(rs, n, RADIX_NAN_LAST);
+    t_radix = elapsed_since(tstart);
+    for (i=0; i<n && result; i++) {
+        if (ms[i] != ref[i] || rs[i] != ref[i]) {
+            printf("Test double FALLITO: merge[%d]=%f, radix[%d]=%f, atteso=%f\n",
+                   i, ms[i], i, rs[i], ref[i]);
+            result = 0;
+        }
+    }
+    if (result) {
+        printf("Test double OK n=%d (qsort %f, merge %f, radix %f seconds)\n",
+               n, t_qsort, t_merge, t_radix);
+    }
+    free(ref);
+    free(ms);
+    free(rs);
+    return result;
+}
+
+/* Verifica la collocazione dei NaN prodotta da `radix_sort_double()`
+   con ciascuna delle politiche possibili */
+int test_nan( void )
+{
+    const double pos_nan = make_nan(0), neg_nan = make_nan(1);
+    double v[8];
+    int result = 1;
+
+    v[0] = 3.0; v[1] = pos_nan; v[2] = -1.0; v[3] = neg_nan;
+    v[4] = 2.0; v[5] = -0.5; v[6] = pos_nan; v[7] = 0.0;
+    radix_sort_double(v, 8, RADIX_NAN_FIRST);
+    result &= (v[0] != v[0]) && (v[1] != v[1]) && (v[2] != v[2]);
+    result &= (v[3] == -1.0 && v[4] == -0.5 && v[5] == 0.0 && v[6] == 2.0 && v[7] == 3.0);
+
+    v[0] = 3.0; v[1] = pos_nan; v[2] = -1.0; v[3] = neg_nan;
+    v[4] = 2.0; v[5] = -0.5; v[6] = pos_nan; v[7] = 0.0;
+    radix_sort_double(v, 8, RADIX_NAN_LAST);
+    result &= (v[0] == -1.0 && v[1] == -0.5 && v[2] == 0.0 && v[3] == 2.0 && v[4] == 3.0);
+    result &= (v[5] != v[5]) && (v[6] != v[6]) && (v[7] != v[7]);
+
+    v[0] = 3.0; v[1] = pos_nan; v[2] = -1.0; v[3] = neg_nan;
+    v[4] = 2.0; v[5] = -0.5; v[6] = pos_nan; v[7] = 0.0;
+    radix_sort_double(v, 8, RADIX_NAN_TOTAL_ORDER);
+    result &= (v[0] != v[0]) && (v[1] == -1.0) && (v[5] == 3.0);
+    result &= (v[6] != v[6]) && (v[7] != v[7]);
+
+    printf("Test NaN %s\n", result ? "OK" : "FALLITO");
+    return result;
+}
+
+/* Calcola le misure di disordine di v[] con un algoritmo banale
+   O(n^2), per confronto con `sort_metrics()` */
+void brute_metrics(const int *v, int n, SortMetrics *m)
+{
+    int i, j, len = 0;
+
+    m->inversions = 0;
+    m->runs = m->longest_run = 0;
+    for (i=0; i<n; i++) {
+        for (j=i+1; j<n; j++) {
+            if (v[i] > v[j])
+                m->inversions++;
+        }
+        if (i == 0 || v[i-1] > v[i]) {
+            m->runs++;
+            len = 0;
+        }
+        len++;
+        if (len > m->longest_run)
+            m->longest_run = len;
+    }
+}
+
+/* Confronta le misure prodotte da `sort_metrics()` con quelle
+   calcolate da `brute_metrics()`, e verifica che v[] venga
+   ordinato. Restituisce true (nonzero) se il test ha successo. */
+int test_metrics(const int *v, int n)
+{
+    int *w = (int*)malloc((n > 0 ? n : 1) * sizeof(*w));
+    SortMetrics m, expected;
+    int i, result;
+
+    assert(w != NULL);
+    memcpy(w, v, n*sizeof(*v));
+    brute_metrics(v, n, &expected);
+    sort_metrics(w, n, &m);
+    result = (m.inversions == expected.inversions &&
+              m.runs == expected.runs &&
+              m.longest_run == expected.longest_run);
+    for (i=1; i<n; i++) {
+        result = result && (w[i-1] <= w[i]);
+    }
+    if (result) {
+        printf("Test metrics OK n=%d (inversions=%" PRId64 ", runs=%d, longest_run=%d)\n",
+               n, m.inversions, m.runs, m.longest_run);
+    } else {
+        printf("Test metrics FALLITO n=%d: inversions=%" PRId64 " runs=%d longest_run=%d, attesi %" PRId64 " %d %d\n",
+               n, m.inversions, m.runs, m.longest_run,
+               expected.inversions, expected.runs, expected.longest_run);
+    }
+    free(w);
+    return result;
+}
+
+/* Estrae con `incsort_next()` / `incsort_next_k()` tutti gli
+   elementi di v[] e li confronta con il risultato di qsort(); misura
+   inoltre il tempo per estrarre solo i primi `k` elementi rispetto a
+   quello per ordinare l'intero array con `sort()`. Restituisce true
+   (nonzero) se il test ha successo. */
+int test_incsort(const int *v, int n, int k)
+{
+    int *ref = (int*)malloc((n > 0 ? n : 1) * sizeof(*ref));
+    int *w = (int*)malloc((n > 0 ? n : 1) * sizeof(*w));
+    int *out = (int*)malloc((n > 0 ? n : 1) * sizeof(*out));
+    IncSort *s;
+    clock_t tstart;
+    double t_prefix, t_full;
+    int i, m, result = 1;
+
+    assert(ref != NULL && w != NULL && out != NULL);
+    memcpy(ref, v, n*sizeof(*v));
+    qsort(ref, n, sizeof(*ref), compare);
+
+    /* estrazione completa, alternando le due funzioni */
+    memcpy(w, v, n*sizeof(*v));
+    s = incsort_create(w, n);
+    i = 0;
+    while (incsort_has_next(s)) {
+        if (i % 2) {
+            out[i] = incsort_next(s);
+            i++;
+        } else {
+            i += incsort_next_k(s, out + i, randab(1, 50));
+        }
+    }
+    incsort_destroy(s);
+    result = (i == n) && (compare_vec(out, ref, n) < 0) && (compare_vec(w, ref, n) < 0);
+
+    /* solo i primi k elementi */
+    memcpy(w, v, n*sizeof(*v));
+    tstart = clock();
+    s = incsort_create(w, n);
+    m = incsort_next_k(s, out, k);
+    incsort_destroy(s);
+    t_prefix = elapsed_since(tstart);
+    result = result && (m == (k < n ? k : n)) && (compare_vec(out, ref, m) < 0);
+
+    memcpy(w, v, n*sizeof(*v));
+    tstart = clock();
+    sort(w, n);
+    t_full = elapsed_since(tstart);
+
+    if (result) {
+        printf("Test incsort OK n=%d (primi %d: %f seconds, sort(): %f seconds)\n",
+               n, m, t_prefix, t_full);
+    } else {
+        printf("Test incsort FALLITO n=%d\n", n);
+    }
+    free(ref);
+    free(w);
+    free(out);
+    return result;
+}
+
+/* Comprime l'array ordinato v[] di lunghezza n con
+   `packedset_create()` e verifica la decompressione e le ricerche;
+   stampa il rapporto di compressione e confronta il tempo per
+   scandire l'insieme compresso con quello per scandire v[].
+   Restituisce true (nonzero) se il test ha successo. */
+int test_packedset(const int *v, int n)
+{
+    PackedSet *s;
+    int *out = (int*)malloc((n > 0 ? n : 1) * sizeof(*out));
+    int buf[PACKED_BLOCK];
+    clock_t tstart;
+    double t_plain, t_packed;
+    long sum_plain = 0, sum_packed = 0;
+    int i, j, b, m, x, lb, result;
+
+    assert(out != NULL);
+    s = packedset_create(v, n);
+    packedset_decode(s, out);
+    result = (packedset_size(s) == n) && (compare_vec(out, v, n) < 0);
+
+    /* ricerca di valori presenti e (probabilmente) assenti, confrontata
+       con una ricerca binaria su v[] */
+    for (j=0; j<1000 && n>0 && result; j++) {
+        i = randab(0, n-1);
+        x = v[i] + randab(-1, 1);
+        lb = 0;
+        m = n;
+        while (lb < m) {
+            const int mid = lb + (m - lb)/2;
+            if (v[mid] < x)
+                lb = mid + 1;
+            else
+                m = mid;
+        }
+        result = (packedset_lower_bound(s, x) == lb) &&
+            (packedset_contains(s, x) == (lb < n && v[lb] == x)) &&
+            (packedset_get(s, i) == v[i]);
+    }
+
+    tstart = clock();
+    for (i=0; i<n; i++) {
+        sum_plain += v[i];
+    }
+    t_plain = elapsed_since(tstart);
+    tstart = clock();
+    for (b=0; b<s->nblocks; b++) {
+        m = packedset_decode_block(s, b, buf);
+        for (i=0; i<m; i++) {
+            sum_packed += buf[i];
+        }
+    }
+    t_packed = elapsed_since(tstart);
+    result = result && (sum_plain == sum_packed);
+
+    if (result) {
+        printf("Test packedset OK n=%d (%lu byte invece di %lu, scansione %f / %f seconds)\n",
+               n, (unsigned long)packedset_bytes(s), (unsigned long)(n * sizeof(*v)),
+               t_packed, t_plain);
+    } else {
+        printf("Test packedset FALLITO n=%d\n", n);
+    }
+    packedset_destroy(s);
+    free(out);
+    return result;
+}
+
+/* Riassunto del risultato di un join, indipendente dall'ordine in
+   cui vengono prodotte le coppie */
+typedef struct {
+    int64_t count;
+    uint64_t checksum;
+} JoinSummary;
+
+/* Contributo della coppia (key, lpay, rpay) al checksum */
+uint64_t join_hash(int key, int lpay, int rpay)
+{
+    uint64_t h = (uint32_t)key;
+    h = h * 0x9E3779B97F4A7C15u + (uint32_t)lpay;
+    h = h * 0x9E3779B97F4A7C15u + (uint32_t)rpay;
+    return h ^ (h >> 29);
+}
+
+/* `arg` punta ad un array di JoinSummary, uno per partizione */
+void join_collect(int key, int lpay, int rpay, int part, void *arg)
+{
+    JoinSummary *js = (JoinSummary*)arg + part;
+    js->count++;
+    js->checksum += join_hash(key, lpay, rpay);
+}
+
+/* Genera due relazioni casuali di lunghezza n con chiavi in
+   [0, nkeys-1] e confronta il risultato di `sort_merge_join()` e di
+   `sort_merge_join_parallel()` (con `nthreads` thread) con quello
+   calcolato con un doppio ciclo se n è piccolo, o tra di loro
+   altrimenti. Restituisce true (nonzero) se il test ha successo. */
+int test_join(int n, int nkeys, int nthreads)
+{
+    int *mem = (int*)malloc(4 * (n > 0 ? n : 1) * sizeof(*mem));
+    int *lk = mem, *lp = mem + n, *rk = mem + 2*n, *rp = mem + 3*n;
+    JoinSummary expected, seq, *par;
+    double tstart, t_seq, t_par;
+    int64_t count_seq, count_par;
+    int i, j, result;
+
+    assert(mem != NULL);
+    par = (JoinSummary*)calloc(nthreads, sizeof(*par));
+    assert(par != NULL);
+    for (i=0; i<n; i++) {
+        lk[i] = randab(0, nkeys-1);
+        lp[i] = i;
+        rk[i] = randab(0, nkeys-1);
+        rp[i] = -i;
+    }
+    expected.count = 0;
+    expected.checksum = 0;
+    if (n <= 2000) {
+        for (i=0; i<n; i++) {
+            for (j=0; j<n; j++) {
+                if (lk[i] == rk[j]) {
+                    expected.count++;
+                    expected.checksum += join_hash(lk[i], lp[i], rp[j]);
+                }
+            }
+        }
+    }
+
+    tstart = wall_time();
+    count_par = sort_merge_join_parallel(lk, lp, n, rk, rp, n, nthreads, join_collect, par);
+    t_par = wall_time() - tstart;
+    for (i=1; i<nthreads; i++) {
+        par[0].count += par[i].count;
+        par[0].checksum += par[i].checksum;
+    }
+
+    seq.count = 0;
+    seq.checksum = 0;
+    tstart = wall_time();
+    count_seq = sort_merge_join(lk, lp, n, rk, rp, n, join_collect, &seq);
+    t_seq = wall_time() - tstart;
+
+    if (n > 2000) {
+        expected = seq;
+    }
+    result = (count_seq == expected.count && seq.count == expected.count &&
+              seq.checksum == expected.checksum &&
+              count_par == expected.count && par[0].count == expected.count &&
+              par[0].checksum == expected.checksum);
+    for (i=1; i<n; i++) {
+        result = result && (lk[i-1] <= lk[i]) && (rk[i-1] <= rk[i]);
+    }
+    if (result) {
+        printf("Test join OK n=%d (%" PRId64 " coppie, sequenziale %f, %d thread %f seconds)\n",
+               n, count_seq, t_seq, nthreads, t_par);
+    } else {
+        printf("Test join FALLITO n=%d\n", n);
+    }
+    free(mem);
+    free(par);
+    return result;
+}
+
+/* Fonde con entrambi gli algoritmi di kmerge.c k sequenze ordinate
+   di lunghezza casuale (alcune vuote), con lunghezza complessiva n,
+   sia in memoria che tramite file temporanei, e confronta il
+   risultato con l'ordinamento della concatenazione delle sequenze */
+int test_kmerge(int k, int n)
+{
+    int *all = (int*)malloc((n > 0 ? n : 1) * sizeof(*all));
+    int *expected = (int*)malloc((n > 0 ? n : 1) * sizeof(*expected));
+    int *out = (int*)malloc((n > 0 ? n : 1) * sizeof(*out));
+    int *len = (int*)calloc(k > 0 ? k : 1, sizeof(*len));
+    const int **run = (const int**)malloc((k > 0 ? k : 1) * sizeof(*run));
+    FILE **in = (FILE**)malloc((k > 0 ? k : 1) * sizeof(*in));
+    const KMergeEngine engine[] = {KMERGE_HEAP, KMERGE_LOSER_TREE};
+    double t[2];
+    clock_t tstart;
+    FILE *f;
+    int i, s, e, start, result = 1;
+
+    assert(all != NULL && expected != NULL && out != NULL);
+    assert(len != NULL && run != NULL && in != NULL);
+    for (i=0; i<n; i++) {
+        /* le sequenze di indice multiplo di 7 (tranne la 0 se k = 1)
+           restano vuote */
+        s = randab(0, k-1);
+        if (k > 1 && s % 7 == 0) {
+            s = (s + 1 < k ? s + 1 : 1);
+        }
+        len[s]++;
+    }
+    for (s=0, start=0; s<k; s++) {
+        for (i=start; i<start + len[s]; i++) {
+            all[i] = (i % 1000 == 0 ? (i % 2000 == 0 ? INT_MAX : INT_MIN) : randab(-1000000, 1000000));
+        }
+        sort(all + start, len[s]);
+        run[s] = all + start;
+        start += len[s];
+    }
+    memcpy(expected, all, n * sizeof(*all));
+    sort(expected, n);
+
+    for (e=0; e<2; e++) {
+        tstart = clock();
+        kmerge_arrays(run, len, k, out, engine[e]);
+        t[e] = elapsed_since(tstart);
+        result = result && (compare_vec(out, expected, n) < 0);
+
+        /* stesse sequenze, lette e scritte su file */
+        for (s=0; s<k; s++) {
+            in[s] = tmpfile();
+            assert(in[s] != NULL);
+            fwrite(run[s], sizeof(int), len[s], in[s]);
+            rewind(in[s]);
+        }
+        f = tmpfile();
+        assert(f != NULL);
+        result = result && (kmerge_files(in, k, f, engine[e]) == n);
+        for (s=0; s<k; s++) {
+            fclose(in[s]);
+        }
+        rewind(f);
+        memset(out, 0, n * sizeof(*out));
+        result = result && ((int)fread(out, sizeof(int), n, f) == n) && (compare_vec(out, expected, n) < 0);
+        fclose(f);
+    }
+    if (result) {
+        printf("Test kmerge OK k=%d n=%d (heap %f, loser tree %f seconds)\n", k, n, t[0], t[1]);
+    } else {
+        printf("Test kmerge FALLITO k=%d n=%d\n", k, n);
+    }
+    free(all);
+    free(expected);
+    free(out);
+    free(len);
+    free(run);
+    free(in);
+    return result;
+}
+
+/* Confronta i tempi di `qsort()`, `sort_double()` e
+   `radix_sort_double()` su n valori reali casuali, e di
+   `sort_int64()` e `radix_sort_int64()` su n timestamp (in
+   microsecondi) quasi ordinati */
+void benchmark(int n)
+{
+    double *vd = (double*)malloc(n * sizeof(*vd));
+    int64_t *vi = (int64_t*)malloc(n * sizeof(*vi));
+    const int64_t T0 = ((int64_t)1700000000) * 1000000;
+    int i;
+
+    assert(vd != NULL && vi != NULL);
+    for (i=0; i<n; i++) {
+        vd[i] = rand_double(1.0e6);
+        vi[i] = T0 + (int64_t)i * 1000 + randab(-5000, 5000);
+    }
+    test_double(vd, n);
+    test_int64(vi, n);
+    free(vd);
+    free(vi);
+}
+
+/* ATTENZIONE: questa macro produce il valore corretto SOLO se v[] è
+   un array dichiarato sullo stack (quindi NON con malloc()). La
+   macro DEVE essere chiamata all'interno di un blocco in cui è stato
+   dichiarato v[] */
+#define ARRAY_LEN(v) (sizeof(v)/sizeof(v[0]))
+
+int main( void )
+{
+    int v1[] = {0, 8, 1, 7, 2, 6, 3, 5, 4};
+    int v2[] = {0, 1, 0, 6, 10, 10, 0, 0, 1, 2, 5, 10, 9, 6, 2, 3, 3, 1, 7};
+    int v3[] = {-1, -3, -2};
+    int v4[] = {2, 2, 2};
+
+    test(v1, ARRAY_LEN(v1));
+    test(v2, ARRAY_LEN(v2));
+    test(v3, ARRAY_LEN(v3));
+    test(v4, ARRAY_LEN(v4));
+
+    {
+        int64_t w1[] = {0, -8, 1, 7, INT64_MIN, 6, INT64_MAX, -5, 4};
+        double w2[] = {0.5, -8.25, 1e300, -1e-300, 0.0, 6.0, -7.5, 2.0};
+        int64_t w3[1000];
+        double w4[1000];
+        int i;
+
+        for (i=0; i<1000; i++) {
+            w3[i] = rand64();
+            w4[i] = rand_double(1.0e9);
+        }
+        test_int64(w1, ARRAY_LEN(w1));
+        test_int64(w3, ARRAY_LEN(w3));
+        test_double(w2, ARRAY_LEN(w2));
+        test_double(w4, ARRAY_LEN(w4));
+        test_nan();
+    }
+
+    {
+        int w5[2000];
+        int i;
+
+        test_metrics(v1, 0);
+        for (i=0; i<2000; i++) {
+            w5[i] = i;
+        }
+        test_metrics(w5, 2000);
+        for (i=0; i<2000; i++) {
+            w5[i] = 2000 - i;
+        }
+        test_metrics(w5, 2000);
+        for (i=0; i<2000; i++) {
+            w5[i] = randab(0, 100);
+        }
+        test_metrics(w5, 2000);
+        for (i=0; i<2000; i++) {
+            w5[i] = (i % 300 < 250 ? i : randab(0, 2000));
+        }
+        test_metrics(w5, 2000);
+    }
+
+    {
+        int *w6 = (int*)malloc(1000000 * sizeof(*w6));
+        int i;
+
+        assert(w6 != NULL);
+        test_incsort(v1, 0, 10);
+        test_incsort(v2, ARRAY_LEN(v2), 5);
+        for (i=0; i<1000000; i++) {
+            w6[i] = randab(0, 10);
+        }
+        test_incsort(w6, 1000, 10);
+        for (i=0; i<1000000; i++) {
+            w6[i] = i;
+        }
+        test_incsort(w6, 1000, 10);
+        for (i=0; i<1000000; i++) {
+            w6[i] = rand();
+        }
+        test_incsort(w6, 1000000, 1000);
+
+        /* insiemi ordinati con densità diverse */
+        test_packedset(v1, 0);
+        test_packedset(v2, ARRAY_LEN(v2));
+        for (i=0; i<1000000; i++) {
+            w6[i] = 1000 + i*3 + randab(0, 2);
+        }
+        test_packedset(w6, 1000000);
+        for (i=0; i<1000000; i++) {
+            w6[i] = randab(-1000000, 1000000) * 1000;
+        }
+        sort(w6, 1000000);
+        test_packedset(w6, 1000000);
+        for (i=0; i<1000; i++) {
+            w6[i] = (i < 500 ? INT_MIN + i : INT_MAX - 999 + i);
+        }
+        test_packedset(w6, 1000);
+        free(w6);
+    }
+
+    test_join(0, 10, 2);
+    test_join(1, 10, 3);
+    test_join(1000, 50, 1);
+    test_join(2000, 300, 4);
+    test_join(1000000, 1000000, 4);
+
+    test_kmerge(0, 0);
+    test_kmerge(1, 1000);
+    test_kmerge(3, 10);
+    test_kmerge(100, 100000);
+    test_kmerge(1000, 10000000);
+
+    benchmark(1000000);
+
+    return EXIT_SUCCESS;
+}
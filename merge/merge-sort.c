@@ -102,7 +102,7 @@ dove:
 
 Compilare con:
 
-        gcc -std=c90 -Wall -Wpedantic merge-sort.c -o merge-sort
+        gcc -std=c90 -Wall -Wpedantic -pthread -I../Minimum-Heap merge-sort.c radix-sort.c incremental-sort.c packed-set.c join.c kmerge.c ../Minimum-Heap/minheap.c merge-sort-main.c -o merge-sort
 
 Per eseguire in ambiente Linux/MacOSX:
 
@@ -213,17 +213,93 @@ generare degli input opportuni. Nel caso possano risultare utili,
 vengono fornite due funzioni `randab()` e `random_shuffle()`, la cui
 specifica è indicata nei commenti al codice.
 
+## Ordinamento di interi a 64 bit e di reali
+
+Le funzioni `sort_int64()` e `sort_double()` applicano lo stesso
+algoritmo ad array di tipo `int64_t` e `double`, rispettivamente. Il
+file [radix-sort.c](radix-sort.c) contiene invece una versione di
+_Radix sort_ per gli stessi tipi, che non effettua confronti e ha
+costo $\Theta(n)$; nel caso dei `double` è necessario stabilire dove
+collocare gli eventuali NaN (si veda [radix-sort.h](radix-sort.h)).
+Il programma [merge-sort-main.c](merge-sort-main.c) confronta i tempi
+di esecuzione delle varie funzioni con quelli di `qsort()`.
+
+## Misure di disordine
+
+La funzione `sort_metrics()` ordina l'array e, durante la stessa
+esecuzione di Merge Sort, conta le _inversioni_ (coppie di elementi
+nell'ordine sbagliato) e le sequenze non decrescenti ("run")
+dell'input. Le inversioni tra le due metà si contano durante la
+fusione: quando un elemento della metà destra viene copiato nel
+buffer, esso è minore di tutti gli elementi rimasti nella metà
+sinistra. Il costo complessivo resta $\Theta(n \log n)$.
+
+## Ordinamento incrementale
+
+Quando servono solo i primi elementi in ordine crescente, ma non si
+sa in anticipo quanti, è possibile usare l'ordinatore incrementale
+definito in [incremental-sort.h](incremental-sort.h), che esegue solo
+il lavoro necessario a produrre l'elemento successivo.
+
+## Insiemi ordinati compressi
+
+Un array ordinato che deve essere conservato a lungo in memoria può
+essere compresso con le funzioni definite in
+[packed-set.h](packed-set.h), che memorizzano le differenze tra valori
+consecutivi con il minimo numero di bit necessario, a blocchi di 128
+valori. I valori si possono decomprimere un blocco alla volta, oppure
+cercare senza decomprimere l'intero insieme.
+
+## Sort-merge join
+
+La funzione `sort_pairs()` ordina coppie (chiave, valore) memorizzate
+in due array paralleli. Il file [join.c](join.c) la usa per calcolare
+il join per uguaglianza di chiave di due relazioni, scandendole dopo
+l'ordinamento con lo stesso schema di `merge()`; è disponibile anche
+una versione parallela che usa i thread POSIX.
+
+## Ordinamento di file di testo
+
+Il programma [numsort.c](numsort.c) usa `sort()` per ordinare interi
+letti da un file di testo, uno per riga, come `sort -n`; la
+conversione da testo è eseguita in parallelo da più thread.
+
+## Versione C++
+
+Il file [merge-sort.hpp](merge-sort.hpp) contiene una versione
+generica dell'algoritmo per C++, `asd::merge_sort<T, Compare>()`, da
+includere direttamente nei sorgenti (non richiede di essere compilata
+separatamente). Il programma
+[merge-sort-cxx-main.cpp](merge-sort-cxx-main.cpp) ne verifica il
+funzionamento; per compilarlo:
+
+        g++ -std=c++11 -Wall -Wpedantic merge-sort-cxx-main.cpp -o merge-sort-cxx
+
 ## File
 
 - [merge-sort.c](merge-sort.c)
+- [merge-sort.h](merge-sort.h)
+- [merge-sort-main.c](merge-sort-main.c)
+- [radix-sort.c](radix-sort.c)
+- [radix-sort.h](radix-sort.h)
+- [incremental-sort.c](incremental-sort.c)
+- [incremental-sort.h](incremental-sort.h)
+- [packed-set.c](packed-set.c)
+- [packed-set.h](packed-set.h)
+- [join.c](join.c)
+- [join.h](join.h)
+- [kmerge.c](kmerge.c)
+- [kmerge.h](kmerge.h)
+- [numsort.c](numsort.c)
+- [mergeruns.c](mergeruns.c)
+- [merge-sort.hpp](merge-sort.hpp)
+- [merge-sort-cxx-main.cpp](merge-sort-cxx-main.cpp)
 
 ***/
 
-#include <stdio.h>
 #include <stdlib.h>
-#include <string.h>
-#include <time.h>
 #include <assert.h>
+#include "merge-sort.h"
 
 /* Fonde i sottovettori ordinati `v[p..q]` e `v[q+1..r]`. Usa
    `buffer[]` come array temporaneo. `buffer[]` ha la stessa lunghezza
@@ -287,125 +363,260 @@ void sort(int *v, int n)
     free(buffer);
 }
 
-void print_array(const int *v, int n)
-{
-    int i;
 
-    printf("[ ");
-    for (i = 0; i < n; i++) {
-        printf("%d ", v[i]);
+/* Versione di `merge()` per interi a 64 bit */
+static void merge_int64(int64_t *v, int p, int q, int r, int64_t *buffer)
+{
+    int i = p, j = q+1, k = 0;
+    while (i<=q && j<=r) {
+        if (v[i] <= v[j]) {
+            buffer[k] = v[i];
+            i++;
+        } else {
+            buffer[k] = v[j];
+            j++;
+        }
+        k++;
+    }
+    while (i<=q) {
+        buffer[k] = v[i];
+        i++;
+        k++;
+    }
+    while (j<=r) {
+        buffer[k] = v[j];
+        j++;
+        k++;
+    }
+    for (k=p; k<=r; k++) {
+        v[k] = buffer[k-p];
     }
-    printf("]");
 }
 
-/* Restituisce un valore casuale compreso tra a e b (estremi inclusi) */
-int randab(int a, int b)
+static void merge_sort_int64(int64_t *v, int p, int r, int64_t *buffer)
 {
-    return a + rand() % (b-a+1);
+    if (p<r) {
+        const int q = (p+r)/2;
+        merge_sort_int64(v, p, q, buffer);
+        merge_sort_int64(v, q+1, r, buffer);
+        merge_int64(v, p, q, r, buffer);
+    }
 }
 
-/* Permuta il contenuto dell'array v[] in modo casuale. Per fare
-   questo:
-
-   - Si scambia v[0] con uno elemento casuale scelto in v[0..n-1].
+void sort_int64(int64_t *v, int n)
+{
+    int64_t *buffer = (int64_t*)malloc(n * sizeof(*buffer));
+    assert(buffer != NULL);
+    merge_sort_int64(v, 0, n-1, buffer);
+    free(buffer);
+}
 
-   - Si scambia v[1] con un elemento casuale scelto in v[1..n-1].
+/* Versione di `merge()` per valori reali */
+static void merge_double(double *v, int p, int q, int r, double *buffer)
+{
+    int i = p, j = q+1, k = 0;
+    while (i<=q && j<=r) {
+        if (v[i] <= v[j]) {
+            buffer[k] = v[i];
+            i++;
+        } else {
+            buffer[k] = v[j];
+            j++;
+        }
+        k++;
+    }
+    while (i<=q) {
+        buffer[k] = v[i];
+        i++;
+        k++;
+    }
+    while (j<=r) {
+        buffer[k] = v[j];
+        j++;
+        k++;
+    }
+    for (k=p; k<=r; k++) {
+        v[k] = buffer[k-p];
+    }
+}
 
-   - ...
+static void merge_sort_double(double *v, int p, int r, double *buffer)
+{
+    if (p<r) {
+        const int q = (p+r)/2;
+        merge_sort_double(v, p, q, buffer);
+        merge_sort_double(v, q+1, r, buffer);
+        merge_double(v, p, q, r, buffer);
+    }
+}
 
-   - Si scambia v[i] con un elemento casuale scelto in v[i..n-1].
+void sort_double(double *v, int n)
+{
+    double *buffer = (double*)malloc(n * sizeof(*buffer));
+    assert(buffer != NULL);
+    merge_sort_double(v, 0, n-1, buffer);
+    free(buffer);
+}
 
-   - ...
+/* Come `merge()`, ma restituisce anche il numero di inversioni tra
+   i due sottovettori, cioè il numero di coppie (i, j) con p <= i <= q
+   < j <= r e v[i] > v[j]. Ogni volta che v[j] viene copiato prima
+   dei q-i+1 elementi ancora presenti in v[i..q], tutti questi
+   formano un'inversione con v[j]. */
+static int64_t merge_count(int *v, int p, int q, int r, int *buffer)
+{
+    int i = p, j = q+1, k = 0;
+    int64_t inv = 0;
+    while (i<=q && j<=r) {
+        if (v[i] <= v[j]) {
+            buffer[k] = v[i];
+            i++;
+        } else {
+            buffer[k] = v[j];
+            inv += q - i + 1;
+            j++;
+        }
+        k++;
+    }
+    while (i<=q) {
+        buffer[k] = v[i];
+        i++;
+        k++;
+    }
+    while (j<=r) {
+        buffer[k] = v[j];
+        j++;
+        k++;
+    }
+    for (k=p; k<=r; k++) {
+        v[k] = buffer[k-p];
+    }
+    return inv;
+}
 
-   È possibile dimostrare che questo procedimento, applicato fino alla
-   fine, produce una permutazione casuale (random shuffle) di v[].
-*/
-void random_shuffle(int *v, int n)
+/* Informazioni sulle sequenze non decrescenti ("run") di un
+   sottovettore, nell'ordine originale: lunghezza del sottovettore,
+   lunghezza del run iniziale e di quello finale, lunghezza del run
+   più lungo e numero di run. */
+typedef struct {
+    int len, prefix, suffix, longest, runs;
+} RunInfo;
+
+/* Ordina v[p..r] come `merge_sort()`, restituendo il numero di
+   inversioni e scrivendo in `*info` le informazioni sui run di
+   v[p..r]. I run si combinano senza dover riesaminare gli elementi:
+   basta sapere se l'ultimo elemento (originale) della metà sinistra
+   è minore o uguale al primo della metà destra, nel qual caso il run
+   finale della prima metà prosegue con quello iniziale della
+   seconda. Tali elementi vanno letti prima delle chiamate ricorsive,
+   che li spostano. */
+static int64_t merge_sort_count(int *v, int p, int r, int *buffer, RunInfo *info)
 {
-    int i;
+    RunInfo L, R;
+    int q, join;
+    int64_t inv;
 
-    for (i=0; i<n-1; i++) {
-        const int j = randab(i, n-1);
-        const int tmp = v[i];
-        v[i] = v[j];
-        v[j] = tmp;
+    if (p == r) {
+        info->len = info->prefix = info->suffix = info->longest = info->runs = 1;
+        return 0;
     }
+    q = (p+r)/2;
+    join = (v[q] <= v[q+1]);
+    inv = merge_sort_count(v, p, q, buffer, &L);
+    inv += merge_sort_count(v, q+1, r, buffer, &R);
+    /* Se le due metà ordinate sono già nell'ordine corretto non ci
+       sono inversioni tra di esse, e non serve fonderle */
+    if (v[q] > v[q+1]) {
+        inv += merge_count(v, p, q, r, buffer);
+    }
+
+    info->len = L.len + R.len;
+    info->runs = L.runs + R.runs - join;
+    info->longest = (L.longest > R.longest ? L.longest : R.longest);
+    info->prefix = L.prefix;
+    info->suffix = R.suffix;
+    if (join) {
+        if (L.suffix + R.prefix > info->longest)
+            info->longest = L.suffix + R.prefix;
+        if (L.prefix == L.len)
+            info->prefix = L.len + R.prefix;
+        if (R.suffix == R.len)
+            info->suffix = R.len + L.suffix;
+    }
+    return inv;
 }
 
-/* Restituisce un intero < 0 se *p1 è minore di *p2 (interpretati come
-   interi), 0 se sono uguali, > 0 se il primo è maggiore del
-   secondo. */
-int compare(const void *p1, const void *p2)
+void sort_metrics(int *v, int n, SortMetrics *m)
 {
-    const int v1 = *(const int*)p1;
-    const int v2 = *(const int*)p2;
-    if (v1 < v2)
-        return -1;
-    else if (v1 > v2)
-        return 1;
-    else
-        return 0;
+    RunInfo info;
+    int *buffer;
+
+    assert(n >= 0);
+    assert(m != NULL);
+    m->inversions = 0;
+    m->runs = m->longest_run = 0;
+    if (n == 0)
+        return;
+    buffer = (int*)malloc(n * sizeof(*buffer));
+    assert(buffer != NULL);
+    m->inversions = merge_sort_count(v, 0, n-1, buffer, &info);
+    m->runs = info.runs;
+    m->longest_run = info.longest;
+    free(buffer);
 }
 
-/* Confronta il contenuto di due array v1 e v2 di lunghezza n;
-   restituisce l'indice del primo elemento il cui valore differisce
-   nei due array, oppure -1 se gli array hanno lo stesso contenuto */
-int compare_vec(const int *v1, const int *v2, int n)
+/* Versione di `merge()` che sposta insieme alle chiavi key[] i
+   valori associati payload[]; `kbuf` e `pbuf` sono i rispettivi
+   buffer temporanei. */
+static void merge_pairs(int *key, int *payload, int p, int q, int r, int *kbuf, int *pbuf)
 {
-    int i;
-    for (i=0; i<n; i++) {
-        if (v1[i] != v2[i])
-            return i;
+    int i = p, j = q+1, k = 0;
+    while (i<=q && j<=r) {
+        if (key[i] <= key[j]) {
+            kbuf[k] = key[i];
+            pbuf[k] = payload[i];
+            i++;
+        } else {
+            kbuf[k] = key[j];
+            pbuf[k] = payload[j];
+            j++;
+        }
+        k++;
+    }
+    while (i<=q) {
+        kbuf[k] = key[i];
+        pbuf[k] = payload[i];
+        i++;
+        k++;
+    }
+    while (j<=r) {
+        kbuf[k] = key[j];
+        pbuf[k] = payload[j];
+        j++;
+        k++;
+    }
+    for (k=p; k<=r; k++) {
+        key[k] = kbuf[k-p];
+        payload[k] = pbuf[k-p];
     }
-    return -1;
 }
 
-/* Ordina l'array v[] di lunghezza n. Confrontiamo il risultato
-   dell'ordinamento con quello prodotto dalla funzione qsort() della
-   libreria standard C. Restituisce true (nonzero) se il test ha
-   successo, 0 altrimenti. */
-int test(int *v, int n)
+static void merge_sort_pairs(int *key, int *payload, int p, int r, int *kbuf, int *pbuf)
 {
-    int result;
-    int *tmp = (int*)malloc(n * sizeof(*tmp));
-    clock_t tstart, elapsed;
-    int diff;
-
-    assert(tmp != NULL); /* evita un warning con VS */
-    memcpy(tmp, v, n*sizeof(*v));
-    qsort(tmp, n, sizeof(*tmp), compare);
-    tstart = clock();
-    sort(v, n);
-    elapsed = clock() - tstart;
-    diff = compare_vec(v, tmp, n);
-    if (diff < 0) {
-        printf("Test OK (%f seconds)\n", ((double)elapsed) / CLOCKS_PER_SEC);
-        result = 1;
-    } else {
-        printf("Test FALLITO: v[%d]=%d, atteso=%d\n", diff, v[diff], tmp[diff]);
-        result = 0;
+    if (p<r) {
+        const int q = (p+r)/2;
+        merge_sort_pairs(key, payload, p, q, kbuf, pbuf);
+        merge_sort_pairs(key, payload, q+1, r, kbuf, pbuf);
+        if (key[q] > key[q+1]) {
+            merge_pairs(key, payload, p, q, r, kbuf, pbuf);
+        }
     }
-    free(tmp);
-    return result;
 }
 
-/* ATTENZIONE: questa macro produce il valore corretto SOLO se v[] è
-   un array dichiarato sullo stack (quindi NON con malloc()). La
-   macro DEVE essere chiamata all'interno di un blocco in cui è stato
-   dichiarato v[] */
-#define ARRAY_LEN(v) (sizeof(v)/sizeof(v[0]))
-
-int main( void )
+void sort_pairs(int *key, int *payload, int n)
 {
-    int v1[] = {0, 8, 1, 7, 2, 6, 3, 5, 4};
-    int v2[] = {0, 1, 0, 6, 10, 10, 0, 0, 1, 2, 5, 10, 9, 6, 2, 3, 3, 1, 7};
-    int v3[] = {-1, -3, -2};
-    int v4[] = {2, 2, 2};
-
-    test(v1, ARRAY_LEN(v1));
-    test(v2, ARRAY_LEN(v2));
-    test(v3, ARRAY_LEN(v3));
-    test(v4, ARRAY_LEN(v4));
-
-    return EXIT_SUCCESS;
+    int *buffer = (int*)malloc(2 * (n > 0 ? n : 1) * sizeof(*buffer));
+    assert(buffer != NULL);
+    merge_sort_pairs(key, payload, 0, n-1, buffer, buffer + n);
+    free(buffer);
 }
@@ -0,0 +1,79 @@
+/****************************************************************************
+ *
+ * merge-sort.h -- Interfaccia Merge Sort
+ *
+ * Copyright (C) 2021--2025 Nicolas Farabegoli, Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef MERGE_SORT_H
+#define MERGE_SORT_H
+
+#include <stdint.h>
+
+/* Fonde i sottovettori ordinati `v[p..q]` e `v[q+1..r]`. Usa
+   `buffer[]` come array temporaneo. `buffer[]` ha la stessa lunghezza
+   dell'intero array `v[]`. */
+void merge(int *v, int p, int q, int r, int *buffer);
+
+/* Ordina il sottovettore v[p..r] (estremi inclusi) usando
+   l'algoritmo Merge-Sort ricorsivo; `buffer[]` è allocato dal
+   chiamante e ha la stessa lunghezza dell'intero array `v[]`. */
+void merge_sort(int *v, int p, int r, int *buffer);
+
+/* Ordina l'array v[] di lunghezza n>=0 usando Merge-Sort. */
+void sort(int *v, int n);
+
+/* Ordina l'array v[] di n>=0 interi a 64 bit usando Merge-Sort. */
+void sort_int64(int64_t *v, int n);
+
+/* Ordina l'array v[] di n>=0 valori reali usando Merge-Sort.
+
+   Precondizione: v[] non contiene NaN (il confronto `<` con un NaN
+   è sempre falso, e il risultato non sarebbe definito); per ordinare
+   array che possono contenere NaN usare `radix_sort_double()`. */
+void sort_double(double *v, int n);
+
+/* Ordina le coppie (key[i], payload[i]), i = 0..n-1, in ordine non
+   decrescente di chiave usando Merge-Sort; i due array vengono
+   permutati nello stesso modo. L'ordinamento è stabile. */
+void sort_pairs(int *key, int *payload, int n);
+
+/* Misure del disordine di un array v[0..n-1]:
+
+   - `inversions` è il numero di coppie di indici i < j tali che
+     v[i] > v[j] (0 se l'array è ordinato, n(n-1)/2 se è ordinato in
+     senso decrescente e privo di duplicati);
+
+   - `runs` è il numero di sequenze massimali di elementi consecutivi
+     in ordine non decrescente (1 se l'array è ordinato);
+
+   - `longest_run` è la lunghezza della più lunga di tali sequenze.
+
+   Per un array vuoto tutti i valori sono zero. */
+typedef struct {
+    int64_t inversions;
+    int runs;
+    int longest_run;
+} SortMetrics;
+
+/* Ordina l'array v[] di lunghezza n>=0 usando Merge-Sort, e calcola
+   le misure di disordine di v[] _prima_ dell'ordinamento, che vengono
+   scritte in `*m`. Costo O(n log n). Chi deve conservare l'array
+   originale deve passarne una copia. */
+void sort_metrics(int *v, int n, SortMetrics *m);
+
+#endif
@@ -0,0 +1,156 @@
+/****************************************************************************
+ *
+ * merge-sort.hpp -- Merge Sort generico per C++ (solo header)
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/* Versione C++ (C++11 o successivo) dell'algoritmo di merge-sort.c,
+   parametrizzata rispetto al tipo `T` degli elementi e al
+   comparatore `Compare`. Rispetto a `qsort()`:
+
+   - il comparatore è un parametro di tipo del template, per cui la
+     chiamata `cmp(a, b)` è diretta e può essere espansa inline dal
+     compilatore (non passa da un puntatore a funzione `void*`);
+
+   - gli elementi vengono spostati con `std::move()`; per i tipi
+     banalmente copiabili (`int`, `double`, strutture semplici) questo
+     si riduce ad una copia, mentre per gli altri (es., `std::string`)
+     evita di duplicare il contenuto. Sono accettati anche tipi che
+     possono essere solo spostati (es., `std::unique_ptr`);
+
+   - i sottovettori di lunghezza minore o uguale a `Cutoff` (costante
+     nota in fase di compilazione) vengono ordinati con Insertion
+     Sort, più efficiente di Merge Sort su pochi elementi.
+
+   L'ordinamento è stabile. `cmp(a, b)` deve restituire `true` se e
+   solo se `a` deve precedere strettamente `b`, come `std::less`.
+
+   Esempio:
+
+        std::vector<double> v = ...;
+        asd::merge_sort(v.data(), v.size());
+        asd::merge_sort(v.data(), v.size(), std::greater<double>());
+        asd::merge_sort<double, std::less<double>, 32>(v.data(), v.size());
+*/
+
+#ifndef MERGE_SORT_HPP
+#define MERGE_SORT_HPP
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+namespace asd {
+
+namespace detail {
+
+/* Ordina v[p..r] (estremi inclusi) con Insertion Sort */
+template <typename T, typename Compare>
+inline void insertion_sort(T *v, std::size_t p, std::size_t r, Compare &cmp)
+{
+    for (std::size_t i = p + 1; i <= r; i++) {
+        if (cmp(v[i], v[i-1])) {
+            T x(std::move(v[i]));
+            std::size_t j = i;
+            do {
+                v[j] = std::move(v[j-1]);
+                j--;
+            } while (j > p && cmp(x, v[j-1]));
+            v[j] = std::move(x);
+        }
+    }
+}
+
+/* Fonde i sottovettori ordinati v[p..q] e v[q+1..r]. La metà
+   sinistra viene spostata in `buffer`, quindi la fusione procede
+   direttamente in v[]; il buffer deve poter contenere metà
+   dell'array. */
+template <typename T, typename Compare>
+inline void merge(T *v, std::size_t p, std::size_t q, std::size_t r,
+                  std::vector<T> &buffer, Compare &cmp)
+{
+    buffer.clear();
+    buffer.insert(buffer.end(),
+                  std::make_move_iterator(v + p),
+                  std::make_move_iterator(v + q + 1));
+
+    typename std::vector<T>::iterator i = buffer.begin();
+    const typename std::vector<T>::iterator iend = buffer.end();
+    std::size_t j = q + 1, k = p;
+
+    while (i != iend && j <= r) {
+        if (cmp(v[j], *i)) {
+            v[k] = std::move(v[j]);
+            j++;
+        } else {
+            v[k] = std::move(*i);
+            ++i;
+        }
+        k++;
+    }
+    /* Gli eventuali elementi rimasti in v[j..r] sono già al loro
+       posto */
+    std::move(i, iend, v + k);
+}
+
+template <typename T, typename Compare, std::size_t Cutoff>
+void merge_sort(T *v, std::size_t p, std::size_t r,
+                std::vector<T> &buffer, Compare &cmp)
+{
+    if (r - p < Cutoff) {
+        insertion_sort(v, p, r, cmp);
+    } else {
+        const std::size_t q = p + (r - p) / 2;
+        merge_sort<T, Compare, Cutoff>(v, p, q, buffer, cmp);
+        merge_sort<T, Compare, Cutoff>(v, q+1, r, buffer, cmp);
+        /* Se le due metà sono già nell'ordine corretto non serve
+           fonderle */
+        if (cmp(v[q+1], v[q])) {
+            merge(v, p, q, r, buffer, cmp);
+        }
+    }
+}
+
+} /* namespace detail */
+
+/* Ordina l'array v[] di lunghezza n rispetto a `cmp`. */
+template <typename T, typename Compare = std::less<T>, std::size_t Cutoff = 16>
+void merge_sort(T *v, std::size_t n, Compare cmp = Compare())
+{
+    static_assert(Cutoff >= 1, "Cutoff must be positive");
+    if (n < 2)
+        return;
+    std::vector<T> buffer;
+    if (n > Cutoff)
+        buffer.reserve(n/2 + 1);
+    detail::merge_sort<T, Compare, Cutoff>(v, 0, n-1, buffer, cmp);
+}
+
+/* Ordina il contenuto del vettore `v` rispetto a `cmp`. */
+template <typename T, typename Compare = std::less<T>, std::size_t Cutoff = 16>
+void merge_sort(std::vector<T> &v, Compare cmp = Compare())
+{
+    merge_sort<T, Compare, Cutoff>(v.data(), v.size(), cmp);
+}
+
+} /* namespace asd */
+
+#endif
@@ -0,0 +1,168 @@
+/****************************************************************************
+ *
+ * mergeruns.c -- Fusione di file ordinati di interi
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Fusione di file ordinati di interi
+% Ultimo aggiornamento: 2026-10-19
+
+Questo programma fonde $k$ file, ciascuno contenente una sequenza
+ordinata in modo non decrescente di interi (tipo `int`) nella
+rappresentazione binaria della macchina, in un unico file ordinato
+nello stesso formato, usando `kmerge_files()` (si veda
+[kmerge.c](kmerge.c)). Per default viene usato l'albero dei perdenti;
+con l'opzione `-heap` viene usato `MinHeap`.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -O2 -pthread -I../Minimum-Heap ../Minimum-Heap/minheap.c merge-sort.c kmerge.c mergeruns.c -o mergeruns
+
+Per eseguire in ambiente Linux/MacOSX:
+
+        ./mergeruns [-heap] output.bin run0.bin run1.bin ...
+
+Il nome "-" come file di output indica lo standard output. Il
+comando
+
+        ./mergeruns inputgen k n prefix
+
+crea i file `prefix0.bin`, ..., `prefix<k-1>.bin`, contenenti
+complessivamente `n` interi casuali ordinati, utili per le misure.
+
+## File
+
+- [mergeruns.c](mergeruns.c)
+- [kmerge.c](kmerge.c)
+- [kmerge.h](kmerge.h)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "kmerge.h"
+#include "merge-sort.h"
+
+/* Crea k file prefix0.bin, ..., prefix<k-1>.bin che contengono
+   complessivamente n interi casuali, ordinati all'interno di
+   ciascun file */
+static int inputgen(int k, int n, const char *prefix)
+{
+    char *fname = (char*)malloc(strlen(prefix) + 32);
+    int *v = (int*)malloc((n / k + 1) * sizeof(*v));
+    int s, i, len, err;
+    FILE *f;
+
+    assert(fname != NULL && v != NULL);
+    srand((unsigned int)n);
+    for (s=0; s<k; s++) {
+        len = n / k + (s < n % k);
+        for (i=0; i<len; i++) {
+            v[i] = rand() - RAND_MAX/2;
+        }
+        sort(v, len);
+        sprintf(fname, "%s%d.bin", prefix, s);
+        f = fopen(fname, "wb");
+        if (f == NULL) {
+            fprintf(stderr, "Can not open %s\n", fname);
+            free(fname);
+            free(v);
+            return EXIT_FAILURE;
+        }
+        err = (fwrite(v, sizeof(*v), len, f) != (size_t)len);
+        err = (fclose(f) != 0) || err;
+        if (err) {
+            fprintf(stderr, "Error writing %s\n", fname);
+            free(fname);
+            free(v);
+            return EXIT_FAILURE;
+        }
+    }
+    free(fname);
+    free(v);
+    return EXIT_SUCCESS;
+}
+
+int main( int argc, char *argv[] )
+{
+    KMergeEngine engine = KMERGE_LOSER_TREE;
+    FILE **in, *out = stdout;
+    const char *outname;
+    long count;
+    int k, s, a = 1, err;
+
+    if (argc == 5 && strcmp(argv[1], "inputgen") == 0) {
+        if (atoi(argv[2]) < 1 || atoi(argv[3]) < 0) {
+            fprintf(stderr, "Invalid arguments\n");
+            return EXIT_FAILURE;
+        }
+        return inputgen(atoi(argv[2]), atoi(argv[3]), argv[4]);
+    }
+    if (a < argc && strcmp(argv[a], "-heap") == 0) {
+        engine = KMERGE_HEAP;
+        a++;
+    }
+    if (a >= argc) {
+        fprintf(stderr, "Usage: %s [-heap] outputfile [inputfile ...]\n", argv[0]);
+        fprintf(stderr, "       %s inputgen k n prefix\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    outname = argv[a++];
+    k = argc - a;
+
+    in = (FILE**)malloc((k > 0 ? k : 1) * sizeof(*in));
+    assert(in != NULL);
+    for (s=0; s<k; s++) {
+        in[s] = fopen(argv[a + s], "rb");
+        if (in[s] == NULL) {
+            fprintf(stderr, "Can not open %s\n", argv[a + s]);
+            while (s > 0) fclose(in[--s]);
+            free(in);
+            return EXIT_FAILURE;
+        }
+    }
+    if (strcmp(outname, "-") != 0) {
+        out = fopen(outname, "wb");
+        if (out == NULL) {
+            fprintf(stderr, "Can not open %s\n", outname);
+            for (s=0; s<k; s++) fclose(in[s]);
+            free(in);
+            return EXIT_FAILURE;
+        }
+    }
+
+    count = kmerge_files(in, k, out, engine);
+    err = (count < 0);
+    for (s=0; s<k; s++) {
+        fclose(in[s]);
+    }
+    if (out != stdout) {
+        err = (fclose(out) != 0) || err;
+    } else {
+        err = (fflush(out) != 0) || err;
+    }
+    free(in);
+    if (err) {
+        fprintf(stderr, "Error merging %d files into %s\n", k, outname);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,372 @@
+/****************************************************************************
+ *
+ * numsort.c -- Ordinamento di file di testo contenenti interi
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Ordinamento numerico di file di testo
+% Ultimo aggiornamento: 2026-10-19
+
+Questo programma legge una sequenza di interi (tipo `int`) in formato
+testo, uno per riga, da un file o dallo standard input, li ordina con
+`sort()` (Merge Sort) e li stampa in ordine crescente sullo standard
+output, uno per riga. Produce lo stesso risultato di `sort -n`, ma
+molto più velocemente, perché i valori vengono convertiti una sola
+volta in interi e poi ordinati come tali.
+
+Per ridurre il costo della conversione da testo:
+
+- l'intero input viene letto in memoria con poche chiamate a
+  `fread()`;
+
+- l'input viene diviso in `nthreads` parti di dimensione simile, i
+  cui confini cadono all'inizio di una riga; ogni thread converte i
+  numeri di una parte. Una prima passata conta i numeri presenti in
+  ciascuna parte, in modo che nella seconda ogni thread sappia dove
+  scrivere i propri valori nell'array di destinazione;
+
+- l'output viene formattato "a mano" in un buffer di grandi
+  dimensioni, scritto con `fwrite()` quando è pieno, anziché usando
+  `printf()` per ciascun valore.
+
+Le righe vuote e gli spazi attorno ai numeri vengono ignorati; se
+l'input contiene altro, o valori che non sono rappresentabili come
+`int`, il programma termina con un errore.
+
+Per compilare:
+
+        gcc -std=c90 -Wall -Wpedantic -pthread merge-sort.c numsort.c -o numsort
+
+Per eseguire in ambiente Linux/MacOSX:
+
+        ./numsort [-j nthreads] input.txt > output.txt
+        ./numsort [-j nthreads] - < input.txt > output.txt
+
+Il comando
+
+        ./numsort inputgen n
+
+stampa `n` interi casuali, utili per le misure.
+
+## File
+
+- [numsort.c](numsort.c)
+- [merge-sort.c](merge-sort.c)
+- [merge-sort.h](merge-sort.h)
+
+***/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <assert.h>
+#include <pthread.h>
+#include "merge-sort.h"
+
+#define NUMSORT_MAX_THREADS 64
+#define READ_BLOCK (1 << 20)
+#define WRITE_BLOCK (1 << 16)
+
+/* Parte dell'input assegnata ad un thread */
+typedef struct {
+    const char *begin, *end;
+    int *out;      /* destinazione dei valori (NULL: solo conteggio) */
+    long count;    /* numero di valori trovati */
+    long bad_line; /* > 0 se la parte contiene un errore */
+} ParseTask;
+
+static int is_space(char c)
+{
+    return (c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v');
+}
+
+/* Converte i numeri presenti in [t->begin, t->end), uno per riga,
+   scrivendoli in t->out (se non è NULL). In caso di errore imposta
+   t->bad_line al numero della riga (contato dall'inizio della parte)
+   e si interrompe. */
+static void *parse_worker(void *arg)
+{
+    ParseTask *t = (ParseTask*)arg;
+    const char *p = t->begin, *end = t->end;
+    long line = 1;
+
+    t->count = 0;
+    t->bad_line = 0;
+    while (p < end) {
+        int neg = 0;
+        unsigned long x = 0;
+        const char *digits;
+        const unsigned long limit = (unsigned long)INT_MAX + 1;
+
+        /* spazi e righe vuote */
+        while (p < end && is_space(*p) && *p != '\n')
+            p++;
+        if (p < end && *p == '\n') {
+            p++;
+            line++;
+            continue;
+        }
+        if (p == end)
+            break;
+
+        if (*p == '-' || *p == '+') {
+            neg = (*p == '-');
+            p++;
+        }
+        digits = p;
+        while (p < end && *p >= '0' && *p <= '9') {
+            const unsigned long d = (unsigned long)(*p - '0');
+            if (x > (limit - d) / 10) {
+                t->bad_line = line;
+                return NULL;
+            }
+            x = x*10 + d;
+            p++;
+        }
+        while (p < end && is_space(*p) && *p != '\n')
+            p++;
+        if (p == digits || (p < end && *p != '\n') || (!neg && x > (unsigned long)INT_MAX)) {
+            t->bad_line = line;
+            return NULL;
+        }
+        if (t->out != NULL) {
+            t->out[t->count] = (neg ? (x == limit ? INT_MIN : -(int)x) : (int)x);
+        }
+        t->count++;
+    }
+    return NULL;
+}
+
+/* Legge tutto il contenuto di `f`; restituisce un buffer allocato
+   con malloc() e scrive la lunghezza in `*len` */
+static char *read_all(FILE *f, size_t *len)
+{
+    size_t cap = READ_BLOCK, n = 0, r;
+    char *buf = (char*)malloc(cap);
+
+    assert(buf != NULL);
+    while ((r = fread(buf + n, 1, cap - n, f)) > 0) {
+        n += r;
+        if (n == cap) {
+            cap *= 2;
+            buf = (char*)realloc(buf, cap);
+            assert(buf != NULL);
+        }
+    }
+    *len = n;
+    return buf;
+}
+
+/* Esegue parse_worker() su tutte le parti, usando un thread per
+   ciascuna. Restituisce 0 se tutto è andato a buon fine. */
+static int run_tasks(ParseTask *task, int nthreads)
+{
+    pthread_t tid[NUMSORT_MAX_THREADS];
+    int started[NUMSORT_MAX_THREADS];
+    int t;
+
+    for (t=1; t<nthreads; t++) {
+        started[t] = (pthread_create(&tid[t], NULL, parse_worker, &task[t]) == 0);
+        if (!started[t])
+            parse_worker(&task[t]);
+    }
+    parse_worker(&task[0]);
+    for (t=1; t<nthreads; t++) {
+        if (started[t])
+            pthread_join(tid[t], NULL);
+    }
+    for (t=0; t<nthreads; t++) {
+        if (task[t].bad_line > 0)
+            return -1;
+    }
+    return 0;
+}
+
+/* Stampa il numero della riga di input in cui si trova l'errore */
+static void report_error(const ParseTask *task, int nthreads, const char *fname)
+{
+    long line = 0;
+    const char *p;
+    int t;
+
+    for (t=0; t<nthreads; t++) {
+        if (task[t].bad_line > 0) {
+            fprintf(stderr, "%s:%ld: invalid integer\n", fname, line + task[t].bad_line);
+            return;
+        }
+        for (p = task[t].begin; p < task[t].end; p++) {
+            line += (*p == '\n');
+        }
+    }
+}
+
+/* Scrive v[0..n-1] su `f`, uno per riga. Restituisce 0 in caso di
+   successo, -1 in caso di errore di scrittura. */
+static int write_all(FILE *f, const int *v, int n)
+{
+    static char buf[WRITE_BLOCK];
+    char digits[16];
+    size_t len = 0;
+    int i, k;
+
+    for (i=0; i<n; i++) {
+        unsigned int x;
+        if (len + sizeof(digits) > sizeof(buf)) {
+            if (fwrite(buf, 1, len, f) != len)
+                return -1;
+            len = 0;
+        }
+        if (v[i] < 0) {
+            buf[len++] = '-';
+            x = 0u - (unsigned int)v[i];
+        } else {
+            x = (unsigned int)v[i];
+        }
+        k = 0;
+        do {
+            digits[k++] = (char)('0' + x % 10);
+            x /= 10;
+        } while (x != 0);
+        while (k > 0) {
+            buf[len++] = digits[--k];
+        }
+        buf[len++] = '\n';
+    }
+    return (fwrite(buf, 1, len, f) == len ? 0 : -1);
+}
+
+/* Stampa n interi casuali, uno per riga. Restituisce 0 in caso di
+   successo, -1 in caso di errore di scrittura. */
+static int inputgen(int n)
+{
+    int *v = (int*)malloc((n > 0 ? n : 1) * sizeof(*v));
+    int i, err;
+
+    assert(v != NULL);
+    srand((unsigned int)n);
+    for (i=0; i<n; i++) {
+        v[i] = (rand() % 2000001) - 1000000;
+    }
+    err = write_all(stdout, v, n);
+    err = (fflush(stdout) != 0) || err;
+    free(v);
+    return (err ? -1 : 0);
+}
+
+int main( int argc, char *argv[] )
+{
+    ParseTask task[NUMSORT_MAX_THREADS];
+    const char *fname = "-";
+    FILE *filein = stdin;
+    char *text;
+    size_t len, chunk;
+    long n = 0;
+    int *v;
+    int nthreads = 4, t, a = 1, err;
+
+    if (argc == 3 && strcmp(argv[1], "inputgen") == 0) {
+        if (inputgen(atoi(argv[2])) != 0) {
+            fprintf(stderr, "Error writing output\n");
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    if (a+1 < argc && strcmp(argv[a], "-j") == 0) {
+        nthreads = atoi(argv[a+1]);
+        a += 2;
+    }
+    if (a < argc) {
+        fname = argv[a];
+        a++;
+    }
+    if (a != argc || nthreads < 1 || nthreads > NUMSORT_MAX_THREADS) {
+        fprintf(stderr, "Usage: %s [-j nthreads] [inputfile]\n", argv[0]);
+        fprintf(stderr, "       %s inputgen n\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(fname, "-") != 0) {
+        filein = fopen(fname, "rb");
+        if (filein == NULL) {
+            fprintf(stderr, "Can not open %s\n", fname);
+            return EXIT_FAILURE;
+        }
+    }
+    text = read_all(filein, &len);
+    err = ferror(filein);
+    if (filein != stdin) fclose(filein);
+    if (err) {
+        fprintf(stderr, "Error reading %s\n", fname);
+        free(text);
+        return EXIT_FAILURE;
+    }
+
+    /* Divisione dell'input in parti che iniziano all'inizio di una
+       riga */
+    chunk = len / nthreads + 1;
+    task[0].begin = text;
+    for (t=0; t<nthreads; t++) {
+        const char *e = (t+1 < nthreads && task[t].begin + chunk < text + len ?
+                         task[t].begin + chunk : text + len);
+        while (e < text + len && e[-1] != '\n')
+            e++;
+        task[t].end = e;
+        task[t].out = NULL;
+        if (t+1 < nthreads)
+            task[t+1].begin = e;
+    }
+
+    /* Prima passata: conteggio */
+    if (run_tasks(task, nthreads) != 0) {
+        report_error(task, nthreads, fname);
+        free(text);
+        return EXIT_FAILURE;
+    }
+    for (t=0; t<nthreads; t++) {
+        n += task[t].count;
+    }
+    if (n > INT_MAX) {
+        fprintf(stderr, "Too many values\n");
+        free(text);
+        return EXIT_FAILURE;
+    }
+
+    /* Seconda passata: conversione */
+    v = (int*)malloc((n > 0 ? n : 1) * sizeof(*v));
+    assert(v != NULL);
+    n = 0;
+    for (t=0; t<nthreads; t++) {
+        task[t].out = v + n;
+        n += task[t].count;
+    }
+    run_tasks(task, nthreads);
+    free(text);
+
+    sort(v, (int)n);
+    err = write_all(stdout, v, (int)n);
+    err = (fflush(stdout) != 0) || err;
+
+    free(v);
+    if (err) {
+        fprintf(stderr, "Error writing output\n");
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,331 @@
+/****************************************************************************
+ *
+ * packed-set.c -- Insiemi ordinati di interi compressi
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Insiemi ordinati di interi compressi
+% Ultimo aggiornamento: 2026-10-19
+
+Un array ordinato di interi può essere memorizzato in modo molto più
+compatto se, anziché i valori, si memorizzano le _differenze_ tra
+valori consecutivi: se l'array è "denso", le differenze sono piccole
+e possono essere rappresentate con pochi bit.
+
+L'array viene diviso in blocchi di `PACKED_BLOCK` = 128 valori. Per
+ogni blocco si memorizzano:
+
+- il primo valore del blocco (`block_min[]`), che è anche il minimo;
+
+- il numero $b$ di bit sufficiente a rappresentare la massima
+  differenza tra valori consecutivi del blocco (`bits[]`);
+
+- le 128 differenze (la prima è sempre zero), ciascuna con $b$ bit,
+  per un totale di $4b$ parole di 32 bit.
+
+Le differenze non sono disposte in sequenza, ma su quattro "corsie"
+interlacciate: la differenza di indice $i$ appartiene alla corsia $i
+\bmod 4$, e la parola $w$ della corsia $l$ si trova in posizione $4w
++ l$. In questo modo la decodifica può estrarre con le stesse
+operazioni (scorrimenti e maschere) quattro differenze consecutive
+alla volta, usando le istruzioni SIMD SSE2 quando disponibili; le
+differenze estratte vengono poi sommate (somma prefissa) per
+ricostruire i valori.
+
+Le differenze sono calcolate in aritmetica senza segno a 32 bit, per
+cui l'array può contenere qualsiasi valore `int`, anche negativo.
+
+La ricerca del primo valore $\geq x$ esegue una ricerca binaria su
+`block_min[]`, che è ordinato, e decomprime un solo blocco.
+
+## File
+
+- [packed-set.c](packed-set.c)
+- [packed-set.h](packed-set.h)
+
+***/
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "packed-set.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+/* Restituisce il numero di bit necessari a rappresentare x */
+static int bit_width(uint32_t x)
+{
+    int b = 0;
+    while (x != 0) {
+        b++;
+        x >>= 1;
+    }
+    return b;
+}
+
+/* Comprime le differenze d[0..PACKED_BLOCK-1] usando b bit ciascuna
+   in w[0..4b-1], che deve essere inizialmente azzerato */
+static void pack(const uint32_t *d, int b, uint32_t *w)
+{
+    int j, l;
+
+    for (j=0; j<PACKED_BLOCK/4; j++) {
+        const int pos = j*b, wi = pos >> 5, sh = pos & 31;
+        for (l=0; l<4; l++) {
+            const uint32_t x = d[4*j + l];
+            w[4*wi + l] |= x << sh;
+            if (sh + b > 32) {
+                w[4*(wi+1) + l] |= x >> (32 - sh);
+            }
+        }
+    }
+}
+
+#ifdef __SSE2__
+/* Decomprime un blocco di differenze da w[], le somma a partire da
+   `base` e scrive i PACKED_BLOCK valori in out[] */
+static void unpack(const uint32_t *w, int b, uint32_t base, int *out)
+{
+    const __m128i mask = _mm_set1_epi32(b == 32 ? -1 : (int)(((uint32_t)1 << b) - 1));
+    __m128i prev = _mm_set1_epi32((int)base);
+    int j;
+
+    for (j=0; j<PACKED_BLOCK/4; j++) {
+        const int pos = j*b, wi = pos >> 5, sh = pos & 31;
+        __m128i x = _mm_srl_epi32(_mm_loadu_si128((const __m128i*)(w + 4*wi)),
+                                  _mm_cvtsi32_si128(sh));
+        if (sh + b > 32) {
+            const __m128i hi = _mm_loadu_si128((const __m128i*)(w + 4*(wi+1)));
+            x = _mm_or_si128(x, _mm_sll_epi32(hi, _mm_cvtsi32_si128(32 - sh)));
+        }
+        x = _mm_and_si128(x, mask);
+        /* somma prefissa delle quattro differenze */
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, prev);
+        _mm_storeu_si128((__m128i*)(out + 4*j), x);
+        prev = _mm_shuffle_epi32(x, 0xFF);
+    }
+}
+#else
+static void unpack(const uint32_t *w, int b, uint32_t base, int *out)
+{
+    const uint32_t mask = (b == 32 ? 0xFFFFFFFFu : ((uint32_t)1 << b) - 1);
+    uint32_t prev = base;
+    int j, l;
+
+    for (j=0; j<PACKED_BLOCK/4; j++) {
+        const int pos = j*b, wi = pos >> 5, sh = pos & 31;
+        for (l=0; l<4; l++) {
+            uint32_t x = w[4*wi + l] >> sh;
+            if (sh + b > 32) {
+                x |= w[4*(wi+1) + l] << (32 - sh);
+            }
+            prev += x & mask;
+            out[4*j + l] = (int)prev;
+        }
+    }
+}
+#endif
+
+PackedSet *packedset_create(const int *v, int n)
+{
+    PackedSet *s = (PackedSet*)malloc(sizeof(*s));
+    uint32_t d[PACKED_BLOCK];
+    uint32_t nwords = 0;
+    int blk, i;
+
+    assert(s != NULL);
+    assert(n >= 0);
+
+    s->n = n;
+    s->nblocks = (n + PACKED_BLOCK - 1) / PACKED_BLOCK;
+    s->block_min = (int*)malloc((s->nblocks + 1) * sizeof(*(s->block_min)));
+    s->block_start = (uint32_t*)malloc((s->nblocks + 1) * sizeof(*(s->block_start)));
+    s->bits = (unsigned char*)malloc(s->nblocks + 1);
+    assert(s->block_min != NULL && s->block_start != NULL && s->bits != NULL);
+
+    /* Prima passata: numero di bit per blocco */
+    for (blk=0; blk<s->nblocks; blk++) {
+        const int lo = blk * PACKED_BLOCK;
+        const int hi = (lo + PACKED_BLOCK < n ? lo + PACKED_BLOCK : n);
+        uint32_t maxd = 0;
+        for (i=lo+1; i<hi; i++) {
+            const uint32_t delta = (uint32_t)v[i] - (uint32_t)v[i-1];
+            assert(v[i-1] <= v[i]);
+            if (delta > maxd)
+                maxd = delta;
+        }
+        s->block_min[blk] = v[lo];
+        s->bits[blk] = (unsigned char)bit_width(maxd);
+        s->block_start[blk] = nwords;
+        nwords += 4 * s->bits[blk];
+    }
+    s->block_start[s->nblocks] = nwords;
+
+    /* Seconda passata: compressione. Le differenze mancanti
+       nell'ultimo blocco valgono zero. */
+    s->words = (uint32_t*)calloc(nwords > 0 ? nwords : 1, sizeof(*(s->words)));
+    assert(s->words != NULL);
+    for (blk=0; blk<s->nblocks; blk++) {
+        const int lo = blk * PACKED_BLOCK;
+        memset(d, 0, sizeof(d));
+        for (i=1; i<PACKED_BLOCK && lo+i<n; i++) {
+            d[i] = (uint32_t)v[lo+i] - (uint32_t)v[lo+i-1];
+        }
+        if (s->bits[blk] > 0) {
+            pack(d, s->bits[blk], s->words + s->block_start[blk]);
+        }
+    }
+    return s;
+}
+
+void packedset_destroy(PackedSet *s)
+{
+    assert(s != NULL);
+
+    free(s->block_min);
+    free(s->block_start);
+    free(s->bits);
+    free(s->words);
+    free(s);
+}
+
+int packedset_size(const PackedSet *s)
+{
+    assert(s != NULL);
+
+    return s->n;
+}
+
+size_t packedset_bytes(const PackedSet *s)
+{
+    assert(s != NULL);
+
+    return sizeof(*s)
+        + (s->nblocks + 1) * (sizeof(*(s->block_min)) + sizeof(*(s->block_start)) + 1)
+        + s->block_start[s->nblocks] * sizeof(*(s->words));
+}
+
+int packedset_decode_block(const PackedSet *s, int b, int *out)
+{
+    const int lo = b * PACKED_BLOCK;
+    int nb;
+
+    assert(s != NULL);
+    assert(b >= 0 && b < s->nblocks);
+
+    nb = s->bits[b];
+    if (nb == 0) {
+        /* tutti i valori del blocco sono uguali */
+        int i;
+        for (i=0; i<PACKED_BLOCK; i++) {
+            out[i] = s->block_min[b];
+        }
+    } else {
+        unpack(s->words + s->block_start[b], nb, (uint32_t)s->block_min[b], out);
+    }
+    return (s->n - lo < PACKED_BLOCK ? s->n - lo : PACKED_BLOCK);
+}
+
+void packedset_decode(const PackedSet *s, int *out)
+{
+    int buf[PACKED_BLOCK];
+    int b, m;
+
+    assert(s != NULL);
+
+    /* tutti i blocchi tranne l'ultimo vengono decompressi direttamente
+       in out[] */
+    for (b=0; b+1<s->nblocks; b++) {
+        packedset_decode_block(s, b, out + b*PACKED_BLOCK);
+    }
+    if (s->nblocks > 0) {
+        m = packedset_decode_block(s, s->nblocks - 1, buf);
+        memcpy(out + (s->nblocks - 1)*PACKED_BLOCK, buf, m * sizeof(*buf));
+    }
+}
+
+int packedset_get(const PackedSet *s, int i)
+{
+    int buf[PACKED_BLOCK];
+
+    assert(s != NULL);
+    assert(i >= 0 && i < s->n);
+
+    packedset_decode_block(s, i / PACKED_BLOCK, buf);
+    return buf[i % PACKED_BLOCK];
+}
+
+/* Restituisce l'indice del primo blocco `b` con block_min[b] >= x,
+   oppure s->nblocks se non esiste. Il primo valore >= x si trova nel
+   blocco b-1 oppure all'inizio del blocco b. */
+static int find_block(const PackedSet *s, int x)
+{
+    int lo = 0, hi = s->nblocks;
+
+    while (lo < hi) {
+        const int mid = lo + (hi - lo)/2;
+        if (s->block_min[mid] < x)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return hi;
+}
+
+int packedset_lower_bound(const PackedSet *s, int x)
+{
+    int buf[PACKED_BLOCK];
+    int b, m, i;
+
+    assert(s != NULL);
+
+    b = find_block(s, x);
+    if (b == 0)
+        return 0;
+    m = packedset_decode_block(s, b - 1, buf);
+    for (i=0; i<m; i++) {
+        if (buf[i] >= x)
+            return (b - 1)*PACKED_BLOCK + i;
+    }
+    return (b - 1)*PACKED_BLOCK + m;
+}
+
+int packedset_contains(const PackedSet *s, int x)
+{
+    int buf[PACKED_BLOCK];
+    int b, m, i;
+
+    assert(s != NULL);
+
+    b = find_block(s, x);
+    if (b < s->nblocks && s->block_min[b] == x)
+        return 1;
+    if (b == 0)
+        return 0;
+    m = packedset_decode_block(s, b - 1, buf);
+    for (i=0; i<m && buf[i] <= x; i++) {
+        if (buf[i] == x)
+            return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+/****************************************************************************
+ *
+ * packed-set.h -- Interfaccia insiemi ordinati di interi compressi
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef PACKED_SET_H
+#define PACKED_SET_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Numero di valori per blocco */
+#define PACKED_BLOCK 128
+
+typedef struct {
+    int n;                 /* numero di valori */
+    int nblocks;           /* numero di blocchi, (n + PACKED_BLOCK - 1)/PACKED_BLOCK */
+    int *block_min;        /* block_min[b] è il primo (minimo) valore del blocco b */
+    uint32_t *block_start; /* indice in words[] dei dati del blocco b */
+    unsigned char *bits;   /* bits[b] è il numero di bit per differenza nel blocco b */
+    uint32_t *words;       /* differenze compresse */
+} PackedSet;
+
+/* Crea la rappresentazione compressa dell'array v[] di lunghezza
+   n>=0, che deve essere ordinato in senso non decrescente (ad
+   esempio, dopo `sort()`). v[] non viene modificato e può essere
+   deallocato dopo la chiamata. */
+PackedSet *packedset_create(const int *v, int n);
+
+/* Dealloca la memoria occupata da `s` */
+void packedset_destroy(PackedSet *s);
+
+/* Restituisce il numero di valori in `s` */
+int packedset_size(const PackedSet *s);
+
+/* Restituisce il numero di byte occupati da `s` */
+size_t packedset_bytes(const PackedSet *s);
+
+/* Decomprime il blocco `b` in out[], che deve poter contenere
+   PACKED_BLOCK valori; restituisce il numero di valori validi
+   (PACKED_BLOCK, tranne eventualmente per l'ultimo blocco).
+
+   Precondizione: 0 <= b < s->nblocks */
+int packedset_decode_block(const PackedSet *s, int b, int *out);
+
+/* Decomprime tutti i valori in out[], che deve avere lunghezza
+   almeno packedset_size(s) */
+void packedset_decode(const PackedSet *s, int *out);
+
+/* Restituisce il valore di indice i.
+
+   Precondizione: 0 <= i < packedset_size(s) */
+int packedset_get(const PackedSet *s, int i);
+
+/* Restituisce l'indice del primo valore >= x, oppure
+   packedset_size(s) se tutti i valori sono minori di x. Viene
+   decompresso un solo blocco. */
+int packedset_lower_bound(const PackedSet *s, int x);
+
+/* Restituisce 1 se e solo se x è presente in `s` */
+int packedset_contains(const PackedSet *s, int x);
+
+#endif
@@ -0,0 +1,202 @@
+/****************************************************************************
+ *
+ * radix-sort.c -- Radix Sort per interi a 64 bit e reali
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+/***
+% LabASD - Radix sort
+% Ultimo aggiornamento: 2026-10-19
+
+_Radix sort_ (LSD, _least significant digit_) ordina chiavi di 64 bit
+considerandole come sequenze di 8 cifre da 8 bit ciascuna. Ad ogni
+passata si ordinano stabilmente le chiavi rispetto ad una cifra,
+partendo da quella meno significativa, usando _counting sort_. Il
+costo è $\Theta(n)$ per ciascuna delle 8 passate, indipendentemente
+dal contenuto dell'array. Gli istogrammi delle 8 cifre vengono
+calcolati con un'unica scansione iniziale; le passate in cui tutte le
+chiavi hanno la stessa cifra (frequente, ad esempio, con i timestamp,
+i cui byte più significativi sono quasi sempre uguali) vengono
+saltate.
+
+Radix sort ordina interi senza segno; per usarlo con altri tipi si
+applica a ciascun valore una trasformazione biiettiva che ne
+preserva l'ordine:
+
+- per un `int64_t` è sufficiente invertire il bit di segno;
+
+- per un `double` (IEEE 754) si invertono _tutti_ i bit dei valori
+  negativi, e il solo bit di segno dei valori positivi. In questo modo
+  i negativi, la cui rappresentazione cresce al diminuire del valore,
+  vengono ordinati correttamente e precedono i positivi.
+
+Dopo l'ordinamento si applica la trasformazione inversa.
+
+I NaN non hanno una posizione "naturale" rispetto agli altri valori;
+la trasformazione precedente li colloca agli estremi in base al bit
+di segno (ordine totale IEEE 754), ma spesso è più utile raccoglierli
+tutti all'inizio o alla fine dell'array. `radix_sort_double()` accetta
+un parametro che indica quale delle tre soluzioni adottare.
+
+## File
+
+- [radix-sort.c](radix-sort.c)
+- [radix-sort.h](radix-sort.h)
+
+***/
+
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include "radix-sort.h"
+
+#define RADIX_BITS 8
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_PASSES (64 / RADIX_BITS)
+
+static const uint64_t SIGN_BIT = ((uint64_t)1) << 63;
+static const uint64_t EXP_MASK = ((uint64_t)0x7FF) << 52;
+static const uint64_t MANT_MASK = (((uint64_t)1) << 52) - 1;
+
+/* Ordina le chiavi senza segno v[0..n-1] usando `tmp[]` (di
+   lunghezza n) come array di appoggio. Al termine il risultato si
+   trova in v[]. */
+static void radix_sort_u64(uint64_t *v, uint64_t *tmp, int n)
+{
+    int count[RADIX_PASSES][RADIX_BUCKETS];
+    uint64_t *src = v, *dst = tmp, *t;
+    int i, d, b, sum;
+
+    memset(count, 0, sizeof(count));
+    for (i=0; i<n; i++) {
+        const uint64_t x = v[i];
+        for (d=0; d<RADIX_PASSES; d++) {
+            count[d][(x >> (d*RADIX_BITS)) & (RADIX_BUCKETS-1)]++;
+        }
+    }
+
+    for (d=0; d<RADIX_PASSES && n>0; d++) {
+        const int shift = d*RADIX_BITS;
+        int *c = count[d];
+
+        /* Se tutte le chiavi hanno la stessa cifra, la passata
+           lascerebbe l'array invariato */
+        if (c[(src[0] >> shift) & (RADIX_BUCKETS-1)] == n)
+            continue;
+
+        sum = 0;
+        for (b=0; b<RADIX_BUCKETS; b++) {
+            const int cnt = c[b];
+            c[b] = sum;
+            sum += cnt;
+        }
+        for (i=0; i<n; i++) {
+            const uint64_t x = src[i];
+            dst[c[(x >> shift) & (RADIX_BUCKETS-1)]++] = x;
+        }
+        t = src; src = dst; dst = t;
+    }
+    if (src != v) {
+        memcpy(v, src, n * sizeof(*v));
+    }
+}
+
+void radix_sort_int64(int64_t *v, int n)
+{
+    /* `int64_t` e `uint64_t` possono essere usati per accedere allo
+       stesso oggetto, per cui non serve copiare le chiavi */
+    uint64_t *u = (uint64_t*)v;
+    uint64_t *tmp;
+    int i;
+
+    assert(n >= 0);
+    tmp = (uint64_t*)malloc((n > 0 ? n : 1) * sizeof(*tmp));
+    assert(tmp != NULL);
+    for (i=0; i<n; i++) {
+        u[i] ^= SIGN_BIT;
+    }
+    radix_sort_u64(u, tmp, n);
+    for (i=0; i<n; i++) {
+        u[i] ^= SIGN_BIT;
+    }
+    free(tmp);
+}
+
+/* Trasformazione che preserva l'ordine dalla rappresentazione IEEE
+   754 di un double ad un intero senza segno, e sua inversa */
+static uint64_t double_to_key(uint64_t bits)
+{
+    return (bits & SIGN_BIT) ? ~bits : (bits ^ SIGN_BIT);
+}
+
+static uint64_t key_to_double(uint64_t key)
+{
+    return (key & SIGN_BIT) ? (key ^ SIGN_BIT) : ~key;
+}
+
+static int is_nan(uint64_t bits)
+{
+    return ((bits & EXP_MASK) == EXP_MASK) && ((bits & MANT_MASK) != 0);
+}
+
+void radix_sort_double(double *v, int n, RadixNanPolicy nan_policy)
+{
+    uint64_t *keys, *tmp, bits;
+    int i, m = 0, k = 0;
+
+    assert(n >= 0);
+    keys = (uint64_t*)malloc(2 * (n > 0 ? n : 1) * sizeof(*keys));
+    assert(keys != NULL);
+    tmp = keys + n;
+
+    /* I valori ordinabili vengono trasformati e copiati in
+       keys[0..m-1]; i NaN (se vanno raccolti ad un estremo) vengono
+       copiati senza modifiche a partire dal fondo di keys[], in modo
+       da preservarne il payload */
+    for (i=0; i<n; i++) {
+        memcpy(&bits, &v[i], sizeof(bits));
+        if (nan_policy != RADIX_NAN_TOTAL_ORDER && is_nan(bits)) {
+            keys[n-1-k] = bits;
+            k++;
+        } else {
+            keys[m] = double_to_key(bits);
+            m++;
+        }
+    }
+
+    radix_sort_u64(keys, tmp, m);
+
+    if (nan_policy == RADIX_NAN_FIRST) {
+        for (i=0; i<k; i++) {
+            memcpy(&v[i], &keys[n-1-i], sizeof(bits));
+        }
+        for (i=0; i<m; i++) {
+            bits = key_to_double(keys[i]);
+            memcpy(&v[k+i], &bits, sizeof(bits));
+        }
+    } else {
+        for (i=0; i<m; i++) {
+            bits = key_to_double(keys[i]);
+            memcpy(&v[i], &bits, sizeof(bits));
+        }
+        for (i=0; i<k; i++) {
+            memcpy(&v[m+i], &keys[n-1-i], sizeof(bits));
+        }
+    }
+    free(keys);
+}
@@ -0,0 +1,47 @@
+/****************************************************************************
+ *
+ * radix-sort.h -- Interfaccia Radix Sort per interi a 64 bit e reali
+ *
+ * Copyright (C) 2026 Moreno Marzolla
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ ****************************************************************************/
+
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <stdint.h>
+
+/* Posizione dei NaN nell'output di `radix_sort_double()`. */
+typedef enum {
+    RADIX_NAN_FIRST,      /* tutti i NaN all'inizio dell'array */
+    RADIX_NAN_LAST,       /* tutti i NaN alla fine dell'array */
+    RADIX_NAN_TOTAL_ORDER /* ordine totale IEEE 754: i NaN con bit di
+                             segno a 1 prima di -inf, gli altri dopo
+                             +inf */
+} RadixNanPolicy;
+
+/* Ordina l'array v[] di n>=0 interi a 64 bit usando Radix sort
+   (LSD, cifre di 8 bit). L'ordinamento è stabile. */
+void radix_sort_int64(int64_t *v, int n);
+
+/* Ordina l'array v[] di n>=0 valori reali usando Radix sort sulla
+   rappresentazione IEEE 754 dei valori. -0.0 precede +0.0. I NaN
+   vengono collocati secondo `nan_policy`; con RADIX_NAN_FIRST e
+   RADIX_NAN_LAST mantengono l'ordine relativo che avevano in
+   input. */
+void radix_sort_double(double *v, int n, RadixNanPolicy nan_policy);
+
+#endif